@@ -215,7 +215,7 @@ std::size_t Mixer::MixSurround(float* samples, std::size_t num_samples)
 
 void Mixer::PushSamples(const s16* samples, std::size_t num_samples)
 {
-  if (IsOutputSampleRateValid())
+  if (IsOutputSampleRateValid() && !m_muted)
   {
     // Big-endian RL-orderered stereo samples.
 
@@ -238,7 +238,7 @@ void Mixer::PushSamples(const s16* samples, std::size_t num_samples)
 
 void Mixer::PushStreamingSamples(const s16* samples, std::size_t num_samples)
 {
-  if (IsOutputSampleRateValid())
+  if (IsOutputSampleRateValid() && !m_muted)
   {
     // Big-endian RL-orderered stereo samples.
 
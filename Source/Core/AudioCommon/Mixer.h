@@ -35,6 +35,10 @@ public:
   void PushSkylanderPortalSamples(const u8* samples, std::size_t num_samples);
   void PushGBASamples(std::size_t device_number, const s16* samples, std::size_t num_samples);
 
+  // While muted, the DMA and streaming samples are dropped instead of played. Used by NetPlay for
+  // the frames it emulates again after a rollback.
+  void SetMuted(bool muted) { m_muted = muted; }
+
   u32 GetSampleRate() const { return m_output_sample_rate; }
   void SetSampleRate(u32 output_sample_rate) { m_output_sample_rate = output_sample_rate; }
 
@@ -193,6 +197,7 @@ private:
 
   bool m_log_dtk_audio = false;
   bool m_log_dsp_audio = false;
+  bool m_muted = false;
 
   float m_config_emulation_speed;
   bool m_config_audio_preserve_pitch;
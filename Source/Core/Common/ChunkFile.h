@@ -20,6 +20,7 @@
 #include <map>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -230,6 +231,18 @@ public:
     return current;
   }
 
+  // In read mode, skips over the next bytes if they are equal to `data`.
+  // Returns whether they were skipped.
+  bool SkipIfEqual(std::span<const u8> data)
+  {
+    if (!IsReadMode() || static_cast<size_t>(m_ptr_end - *m_ptr_current) < data.size())
+      return false;
+    if (std::memcmp(*m_ptr_current, data.data(), data.size()) != 0)
+      return false;
+    *m_ptr_current += data.size();
+    return true;
+  }
+
   // The reserved u32 is set to 0, and a pointer to it is returned.
   // The caller needs to fill in the reserved u32 with the appropriate value later on, if they
   // want a non-zero value there.
@@ -4,8 +4,13 @@
 #include "Common/FileSearch.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <filesystem>
+#include <functional>
+#include <iterator>
+#include <mutex>
 #include <system_error>
+#include <thread>
 
 #include "Common/CommonPaths.h"
 #include "Common/Logging/Log.h"
@@ -21,8 +26,79 @@ namespace fs = std::filesystem;
 
 namespace Common
 {
+// Lists the given directories (and their subdirectories if recursive) on up to max_threads
+// threads. Each thread takes a directory from the queue, lists it and queues the subdirectories
+// it finds, and collects the entries accepted by filter. The order of the result is unspecified.
+static std::vector<std::string>
+WalkDirectories(std::vector<fs::path> directories, bool recursive, size_t max_threads,
+                const std::function<bool(const fs::directory_entry&)>& filter)
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<fs::path> queue = std::move(directories);
+  size_t busy_threads = 0;
+  std::vector<std::string> result;
+
+  const auto walk = [&] {
+    std::vector<std::string> partial_result;
+    std::vector<fs::path> subdirectories;
+
+    std::unique_lock lk(mutex);
+    while (true)
+    {
+      // Once the queue is empty and no thread is listing a directory, no more work can appear.
+      cv.wait(lk, [&] { return !queue.empty() || busy_threads == 0; });
+      if (queue.empty())
+        break;
+
+      const fs::path directory = std::move(queue.back());
+      queue.pop_back();
+      ++busy_threads;
+      lk.unlock();
+
+      std::error_code error;
+      for (auto it = fs::directory_iterator(directory, error); it != fs::directory_iterator();
+           it.increment(error))
+      {
+        if (filter(*it))
+          partial_result.emplace_back(PathToString(it->path()));
+
+        // Like recursive_directory_iterator, don't follow directory symlinks.
+        std::error_code status_error;
+        if (recursive && it->is_directory(status_error) && !it->is_symlink(status_error))
+          subdirectories.push_back(it->path());
+      }
+      if (error)
+      {
+        ERROR_LOG_FMT(COMMON, "DoFileSearch error on {}: {}", PathToString(directory),
+                      error.message());
+      }
+
+      lk.lock();
+      queue.insert(queue.end(), std::make_move_iterator(subdirectories.begin()),
+                   std::make_move_iterator(subdirectories.end()));
+      subdirectories.clear();
+      --busy_threads;
+      cv.notify_all();
+    }
+
+    result.insert(result.end(), std::make_move_iterator(partial_result.begin()),
+                  std::make_move_iterator(partial_result.end()));
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < max_threads; ++i)
+    threads.emplace_back(walk);
+  walk();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  return result;
+}
+
 std::vector<std::string> DoFileSearch(std::span<const std::string_view> directories,
-                                      std::span<const std::string_view> exts, bool recursive)
+                                      std::span<const std::string_view> exts, bool recursive,
+                                      size_t max_threads)
 {
   const bool accept_all = exts.empty();
 
@@ -47,12 +123,14 @@ std::vector<std::string> DoFileSearch(std::span<const std::string_view> director
     });
   };
 
-  std::vector<std::string> result;
-  auto add_filtered = [&](const fs::directory_entry& entry) {
-    auto& path = entry.path();
-    if (accept_all || (!entry.is_directory() && ext_matches(path)))
-      result.emplace_back(PathToString(path));
+  // Runs on the scan threads, so it must not throw.
+  auto filter = [&](const fs::directory_entry& entry) {
+    std::error_code error;
+    return accept_all || (!entry.is_directory(error) && ext_matches(entry.path()));
   };
+
+  std::vector<std::string> result;
+  std::vector<fs::path> native_directories;
   for (const auto& directory : directories)
   {
 #ifdef ANDROID
@@ -67,25 +145,22 @@ std::vector<std::string> DoFileSearch(std::span<const std::string_view> director
     else
 #endif
     {
-      fs::path directory_path = StringToPath(directory);
-      std::error_code error;
-      if (recursive)
-      {
-        for (auto it = fs::recursive_directory_iterator(directory_path, error);
-             it != fs::recursive_directory_iterator(); it.increment(error))
-          add_filtered(*it);
-      }
-      else
-      {
-        for (auto it = fs::directory_iterator(directory_path, error);
-             it != fs::directory_iterator(); it.increment(error))
-          add_filtered(*it);
-      }
-      if (error)
-        ERROR_LOG_FMT(COMMON, "{} error on {}: {}", __func__, directory, error.message());
+      native_directories.push_back(StringToPath(directory));
     }
   }
 
+  if (!native_directories.empty())
+  {
+    // Without recursion there is nothing to distribute beyond the given directories.
+    const size_t thread_limit = std::max<size_t>(max_threads, 1);
+    const size_t thread_count =
+        recursive ? thread_limit : std::min(thread_limit, native_directories.size());
+    std::vector<std::string> partial_result =
+        WalkDirectories(std::move(native_directories), recursive, thread_count, filter);
+    result.insert(result.end(), std::make_move_iterator(partial_result.begin()),
+                  std::make_move_iterator(partial_result.end()));
+  }
+
   // Remove duplicates (occurring because caller gave e.g. duplicate or overlapping directories -
   // not because std::filesystem returns duplicates). Also note that this pathname-based uniqueness
   // isn't as thorough as std::filesystem::equivalent.
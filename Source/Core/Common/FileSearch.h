@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <span>
 #include <string>
 #include <string_view>
@@ -12,9 +13,11 @@ namespace Common
 {
 // Callers can pass empty "exts" to indicate they want all files + directories in results
 // Otherwise, only files matching the extensions are returned
+// With max_threads > 1, recursive searches list up to that many directories concurrently, which
+// helps with storage that has a high latency per request (like network shares).
 std::vector<std::string> DoFileSearch(std::span<const std::string_view> directories,
                                       std::span<const std::string_view> exts = {},
-                                      bool recursive = false);
+                                      bool recursive = false, size_t max_threads = 1);
 
 inline std::vector<std::string> DoFileSearch(std::span<const std::string_view> directories,
                                              std::string_view ext, bool recursive = false)
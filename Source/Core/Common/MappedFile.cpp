@@ -0,0 +1,129 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __LIBRETRO__
+#include "Common/IOFile.h"
+#include "DolphinLibretro/Common/VFile.h"
+#endif
+
+namespace File
+{
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(const std::string& path)
+{
+  Open(path);
+}
+
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+bool MappedFile::Open(const std::string& path)
+{
+  Close();
+
+#ifdef __LIBRETRO__
+  if (Libretro::VFile::HasVFS())
+  {
+    IOFile file(path, "rb");
+    m_buffer.resize(file.GetSize());
+    if (!file || m_buffer.empty() || !file.ReadBytes(m_buffer.data(), m_buffer.size()))
+    {
+      m_buffer.clear();
+      return false;
+    }
+
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return true;
+  }
+#endif
+
+#if defined(_WIN32)
+  const HANDLE file = CreateFileW(UTF8ToWString(path).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  const HANDLE mapping = GetFileSizeEx(file, &size) && size.QuadPart > 0 ?
+                             CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) :
+                             nullptr;
+  // The mapping keeps the file open.
+  CloseHandle(file);
+  if (!mapping)
+    return false;
+
+  const void* const data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data)
+  {
+    CloseHandle(mapping);
+    return false;
+  }
+
+  m_mapping = mapping;
+  m_data = static_cast<const u8*>(data);
+  m_size = static_cast<size_t>(size.QuadPart);
+#else
+  const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1)
+    return false;
+
+  struct stat file_info;
+  void* data = MAP_FAILED;
+  if (fstat(fd, &file_info) == 0 && file_info.st_size > 0)
+    data = mmap(nullptr, file_info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps the file open.
+  close(fd);
+  if (data == MAP_FAILED)
+    return false;
+
+  m_data = static_cast<const u8*>(data);
+  m_size = static_cast<size_t>(file_info.st_size);
+#endif
+
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (!m_data)
+    return;
+
+#ifdef __LIBRETRO__
+  if (!m_buffer.empty())
+  {
+    m_buffer = {};
+    m_data = nullptr;
+    m_size = 0;
+    return;
+  }
+#endif
+
+#if defined(_WIN32)
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping);
+  m_mapping = nullptr;
+#else
+  munmap(const_cast<u8*>(m_data), m_size);
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+}
+}  // namespace File
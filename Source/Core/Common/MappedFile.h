@@ -0,0 +1,50 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+#ifdef __LIBRETRO__
+#include <vector>
+#endif
+
+namespace File
+{
+// Maps a whole file into memory for reading. Pages are only read from disk once they are
+// accessed, so this is cheaper than reading files of which only a small part gets used.
+//
+// The file must not be truncated while it is mapped.
+class MappedFile final
+{
+public:
+  MappedFile();
+  explicit MappedFile(const std::string& path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  bool Open(const std::string& path);
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+  std::span<const u8> GetData() const { return {m_data, m_size}; }
+
+private:
+  const u8* m_data = nullptr;
+  size_t m_size = 0;
+
+#ifdef _WIN32
+  void* m_mapping = nullptr;
+#endif
+#ifdef __LIBRETRO__
+  // The libretro VFS can't map files, so they are read into this buffer instead.
+  std::vector<u8> m_buffer;
+#endif
+};
+}  // namespace File
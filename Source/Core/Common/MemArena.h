@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -50,8 +51,17 @@ public:
   /// @param size The amount of bytes that should be allocated in this region.
   /// @param base_name A base name for the shared memory region, if applicable for this platform.
   /// Will be extended with the process ID.
+  /// @param exported Whether other processes should be able to open the segment by its name. Not
+  /// supported on all platforms. Other processes can only map the segment for reading.
   ///
-  void GrabSHMSegment(size_t size, std::string_view base_name);
+  void GrabSHMSegment(size_t size, std::string_view base_name, bool exported = false);
+
+  ///
+  /// Get the name that other processes can open the memory segment with, if it was exported.
+  ///
+  /// @return The name, or an empty string if the segment isn't exported.
+  ///
+  const std::string& GetExportedSHMSegmentName() const { return m_exported_name; }
 
   ///
   /// Release the memory segment previously allocated with GrabSHMSegment().
@@ -119,6 +129,18 @@ public:
   ///
   bool ChangeMappingProtection(void* view, size_t size, bool writeable);
 
+  ///
+  /// Changes the access allowed to some pages of a section mapped by MapInMemoryRegion.
+  ///
+  /// @param address Page-aligned address within a section mapped by MapInMemoryRegion.
+  /// @param size Page-aligned size of the part of the section to change.
+  /// @param readable Whether the pages should be readable.
+  /// @param writeable Whether the pages should be writeable. Requires readable.
+  ///
+  /// @return Whether the operation succeeded.
+  ///
+  bool ChangeMappingAccess(void* address, size_t size, bool readable, bool writeable);
+
   ///
   /// Unmap a memory region previously mapped with MapInMemoryRegion().
   ///
@@ -133,6 +155,8 @@ public:
   size_t GetPageSize() const;
 
 private:
+  std::string m_exported_name;
+
 #ifdef _WIN32
   WindowsMemoryRegion* EnsureSplitRegionForMapping(void* address, size_t size);
   bool JoinRegionsAfterUnmap(void* address, size_t size);
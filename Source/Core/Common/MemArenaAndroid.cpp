@@ -65,8 +65,11 @@ static int AshmemCreateFileMapping(const char* name, size_t size)
 MemArena::MemArena() = default;
 MemArena::~MemArena() = default;
 
-void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
+void MemArena::GrabSHMSegment(size_t size, std::string_view base_name, bool exported)
 {
+  if (exported)
+    WARN_LOG_FMT(MEMMAP, "Exporting shared memory segments is not supported on this platform");
+
   const std::string name = fmt::format("{}.{}", base_name, getpid());
   m_shm_fd = AshmemCreateFileMapping(name.c_str(), size);
   if (m_shm_fd < 0)
@@ -153,6 +156,20 @@ bool MemArena::ChangeMappingProtection(void* view, size_t size, bool writeable)
   return retval == 0;
 }
 
+bool MemArena::ChangeMappingAccess(void* address, size_t size, bool readable, bool writeable)
+{
+  int prot = PROT_NONE;
+  if (readable)
+    prot |= PROT_READ;
+  if (writeable)
+    prot |= PROT_WRITE;
+
+  int retval = mprotect(address, size, prot);
+  if (retval != 0)
+    NOTICE_LOG_FMT(MEMMAP, "mprotect failed");
+  return retval == 0;
+}
+
 void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
 {
   void* retval = mmap(view, size, PROT_NONE, MAP_SHARED | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
@@ -13,8 +13,11 @@ namespace Common
 MemArena::MemArena() = default;
 MemArena::~MemArena() = default;
 
-void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
+void MemArena::GrabSHMSegment(size_t size, std::string_view base_name, bool exported)
 {
+  if (exported)
+    WARN_LOG_FMT(MEMMAP, "Exporting shared memory segments is not supported on this platform");
+
   kern_return_t retval = vm_allocate(mach_task_self(), &m_shm_address, size, VM_FLAGS_ANYWHERE);
   if (retval != KERN_SUCCESS)
   {
@@ -162,6 +165,22 @@ bool MemArena::ChangeMappingProtection(void* view, size_t size, bool writeable)
   return retval == KERN_SUCCESS;
 }
 
+bool MemArena::ChangeMappingAccess(void* address, size_t size, bool readable, bool writeable)
+{
+  vm_prot_t prot = VM_PROT_NONE;
+  if (readable)
+    prot |= VM_PROT_READ;
+  if (writeable)
+    prot |= VM_PROT_WRITE;
+
+  kern_return_t retval = vm_protect(mach_task_self(), reinterpret_cast<vm_address_t>(address),
+                                    size, false, prot);
+  if (retval != KERN_SUCCESS)
+    ERROR_LOG_FMT(MEMMAP, "ChangeMappingAccess failed: vm_protect returned {0:#x}", retval);
+
+  return retval == KERN_SUCCESS;
+}
+
 void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
 {
   vm_address_t address = reinterpret_cast<vm_address_t>(view);
@@ -7,12 +7,15 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
+#include <set>
 #include <string>
 
 #include <fmt/format.h>
 
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include "Common/Assert.h"
@@ -26,22 +29,56 @@ namespace Common
 MemArena::MemArena() = default;
 MemArena::~MemArena() = default;
 
-void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
+// Exported segments keep their name until they are released, so a process that crashed leaves
+// them behind. Since the names contain the process ID, a segment that exists under a name this
+// process hasn't used yet belongs to a dead process that had the same ID, and is removed.
+static void RemoveStaleSHMSegment(const std::string& file_name)
+{
+  static std::mutex s_used_names_lock;
+  static std::set<std::string> s_used_names;
+
+  std::lock_guard lk(s_used_names_lock);
+  if (s_used_names.insert(file_name).second)
+    shm_unlink(file_name.c_str());
+}
+
+void MemArena::GrabSHMSegment(size_t size, std::string_view base_name, bool exported)
 {
   const std::string file_name = fmt::format("/{}.{}", base_name, getpid());
+  if (exported)
+    RemoveStaleSHMSegment(file_name);
+
+  // Only the current user can open the segment.
   m_shm_fd = shm_open(file_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
   if (m_shm_fd == -1)
   {
     ERROR_LOG_FMT(MEMMAP, "shm_open failed: {}", strerror(errno));
     return;
   }
-  shm_unlink(file_name.c_str());
+
+  // Unless other processes need to find the segment, remove the name right away so that it can't
+  // be leaked if we crash.
+  if (exported)
+    m_exported_name = file_name;
+  else
+    shm_unlink(file_name.c_str());
+
   if (ftruncate(m_shm_fd, size) < 0)
     ERROR_LOG_FMT(MEMMAP, "Failed to allocate low memory space");
+
+  // Other processes may only open an exported segment for reading. Our own descriptor was opened
+  // before and stays writable.
+  if (exported && fchmod(m_shm_fd, 0400) < 0)
+    ERROR_LOG_FMT(MEMMAP, "Failed to make {} read-only: {}", file_name, strerror(errno));
 }
 
 void MemArena::ReleaseSHMSegment()
 {
+  if (!m_exported_name.empty())
+  {
+    shm_unlink(m_exported_name.c_str());
+    m_exported_name.clear();
+  }
   close(m_shm_fd);
 }
 
@@ -117,6 +154,20 @@ bool MemArena::ChangeMappingProtection(void* view, size_t size, bool writeable)
   return retval == 0;
 }
 
+bool MemArena::ChangeMappingAccess(void* address, size_t size, bool readable, bool writeable)
+{
+  int prot = PROT_NONE;
+  if (readable)
+    prot |= PROT_READ;
+  if (writeable)
+    prot |= PROT_WRITE;
+
+  int retval = mprotect(address, size, prot);
+  if (retval != 0)
+    NOTICE_LOG_FMT(MEMMAP, "mprotect failed");
+  return retval == 0;
+}
+
 void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
 {
   void* retval = mmap(view, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
@@ -11,6 +11,7 @@
 #include <fmt/format.h>
 
 #include <windows.h>
+#include <sddl.h>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
@@ -118,16 +119,39 @@ static DWORD GetLowDWORD(u64 value)
   return static_cast<DWORD>(value);
 }
 
-void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
+void MemArena::GrabSHMSegment(size_t size, std::string_view base_name, bool exported)
 {
+  // Other processes may only map an exported segment for reading, and only if they run as the same
+  // user. The OWNER RIGHTS entry also replaces the owner's implicit right to change the DACL. The
+  // access check only happens when the mapping is opened by name, so our own handle stays writable.
+  PSECURITY_DESCRIPTOR read_only_descriptor = nullptr;
+  if (exported && !ConvertStringSecurityDescriptorToSecurityDescriptor(
+                      TEXT("D:P(A;;GR;;;OW)"), SDDL_REVISION_1, &read_only_descriptor, nullptr))
+  {
+    ERROR_LOG_FMT(MEMMAP, "Failed to create a read-only security descriptor: {}",
+                  GetLastErrorString());
+    exported = false;
+  }
+  SECURITY_ATTRIBUTES read_only_attributes{.nLength = sizeof(SECURITY_ATTRIBUTES),
+                                           .lpSecurityDescriptor = read_only_descriptor,
+                                           .bInheritHandle = FALSE};
+
   const std::string name = fmt::format("{}.{}", base_name, GetCurrentProcessId());
-  m_memory_handle =
-      CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, GetHighDWORD(size),
-                        GetLowDWORD(size), UTF8ToTStr(name).c_str());
+  m_memory_handle = CreateFileMapping(INVALID_HANDLE_VALUE,
+                                      exported ? &read_only_attributes : nullptr, PAGE_READWRITE,
+                                      GetHighDWORD(size), GetLowDWORD(size),
+                                      UTF8ToTStr(name).c_str());
+  if (read_only_descriptor)
+    LocalFree(read_only_descriptor);
+
+  // The file mapping is always named, so other processes can already open it.
+  if (m_memory_handle && exported)
+    m_exported_name = name;
 }
 
 void MemArena::ReleaseSHMSegment()
 {
+  m_exported_name.clear();
   if (!m_memory_handle)
     return;
   CloseHandle(m_memory_handle);
@@ -379,6 +403,16 @@ bool MemArena::ChangeMappingProtection(void* view, size_t size, bool writeable)
   return retval != 0;
 }
 
+bool MemArena::ChangeMappingAccess(void* address, size_t size, bool readable, bool writeable)
+{
+  const DWORD protect = writeable ? PAGE_READWRITE : readable ? PAGE_READONLY : PAGE_NOACCESS;
+  DWORD old_protect;
+  const int retval = VirtualProtect(address, size, protect, &old_protect);
+  if (retval == 0)
+    PanicAlertFmt("VirtualProtect failed: {}", GetLastErrorString());
+  return retval != 0;
+}
+
 bool MemArena::JoinRegionsAfterUnmap(void* start_address, size_t size)
 {
   u8* const address = static_cast<u8*>(start_address);
@@ -23,8 +23,11 @@
 #include <algorithm>
 #include <atomic>
 #include <bit>
+#include <cstring>
 #include <iterator>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <variant>
@@ -32,17 +35,22 @@
 
 #include <fmt/format.h>
 
+#include "Common/Align.h"
 #include "Common/CommonTypes.h"
 #include "Common/IniFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Swap.h"
 
 #include "Core/ARDecrypt.h"
 #include "Core/AchievementManager.h"
 #include "Core/CheatCodes.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Debugger/PPCDebugInterface.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 namespace ActionReplay
 {
@@ -111,6 +119,64 @@ struct ARAddr
   operator u32() const { return address; }
 };
 
+// Active codes are translated once into a list of instructions, in which the lines have already
+// been decoded and conditional line skips have been turned into jumps. This saves interpreting
+// every line again each frame, which adds up with large code sets.
+enum class AROpcode : u8
+{
+  // Writes value to count addresses starting at address, address_step bytes apart
+  Write,
+  // Writes value to the address stored at address, plus offset
+  WriteToPointer,
+  // Adds value to the integer at address
+  Add,
+  // Adds value to the float at address
+  AddFloat,
+  // Writes count values starting at address, stepping by address_step and value_step
+  FillAndSlide,
+  // Copies count bytes from address to destination
+  MemoryCopy,
+  // Copies count bytes from the address stored at address to the address stored at destination
+  MemoryCopyWithPointers,
+  // Continues at target (or stops) unless the value at address compares true to value
+  Compare,
+  Jump,
+  End,
+  // Runs line_count lines starting at line through the interpreter. Only used for lines that stop
+  // the code with an error, so that the same error is reported.
+  Interpret,
+};
+
+struct ARInstruction
+{
+  // For Compare and Jump, a target that ends the code
+  static constexpr u32 END_OF_CODE = UINT32_MAX;
+
+  AROpcode opcode = AROpcode::End;
+  // Access size in bytes
+  u8 size = 0;
+  u8 compare_type = 0;
+  u32 address = 0;
+  u32 value = 0;
+  u32 count = 0;
+  union
+  {
+    s32 address_step = 0;
+    u32 offset;
+    u32 destination;
+    u32 target;
+    u32 line;
+  };
+  union
+  {
+    s32 value_step = 0;
+    u32 line_count;
+  };
+};
+
+// The compiled form of the first s_compiled_codes.size() codes in s_active_codes
+static std::vector<std::vector<ARInstruction>> s_compiled_codes;
+
 // ----------------------
 // AR Remote Functions
 void ApplyCodes(std::span<const ARCode> codes, const std::string& game_id, u16 revision)
@@ -121,6 +187,7 @@ void ApplyCodes(std::span<const ARCode> codes, const std::string& game_id, u16 r
   std::lock_guard guard(s_lock);
   s_disable_logging = false;
   s_active_codes.clear();
+  s_compiled_codes.clear();
 
   const auto should_be_activated = [&game_id, &revision](const ARCode& code) {
     return AchievementManager::GetInstance().ShouldARCodeBeActivated(code, game_id, revision);
@@ -134,6 +201,7 @@ void SetSyncedCodesAsActive()
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
+  s_compiled_codes.clear();
 }
 
 void UpdateSyncedCodes(std::span<const ARCode> codes)
@@ -152,6 +220,7 @@ std::vector<ARCode> ApplyAndReturnCodes(std::span<const ARCode> codes)
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
     s_active_codes.clear();
+    s_compiled_codes.clear();
     std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                  [](const ARCode& code) { return code.enabled; });
   }
@@ -845,7 +914,8 @@ static bool ConditionalCode(const Core::CPUThreadGuard& guard, const ARAddr& add
 }
 
 // NOTE: Lock needed to give mutual exclusion to s_current_code and LogInfo
-static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcode)
+static bool InterpretCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcode,
+                                std::span<const AREntry> ops)
 {
   // The mechanism is different than what the real AR uses, so there may be compatibility problems.
 
@@ -860,9 +930,9 @@ static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcod
   s_current_code = &arcode;
 
   LogInfo("Code Name: {}", arcode.name);
-  LogInfo("Number of codes: {}", arcode.ops.size());
+  LogInfo("Number of codes: {}", ops.size());
 
-  for (const AREntry& entry : arcode.ops)
+  for (const AREntry& entry : ops)
   {
     const ARAddr addr(entry.cmd_addr);
     const u32 data = entry.value;
@@ -1003,6 +1073,420 @@ static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcod
   return true;
 }
 
+static u8 GetSizeInBytes(u32 size)
+{
+  switch (size)
+  {
+  case DATATYPE_8BIT:
+    return 1;
+  case DATATYPE_16BIT:
+    return 2;
+  default:
+    return 4;
+  }
+}
+
+static std::vector<ARInstruction> CompileCode(const ARCode& arcode)
+{
+  const std::vector<AREntry>& ops = arcode.ops;
+  std::vector<ARInstruction> program;
+
+  // The instruction at which each line starts, for lines reached with no zero code pending
+  std::vector<std::optional<u32>> line_starts(ops.size());
+  // Lines that are jumped to, but haven't been compiled yet
+  std::vector<size_t> pending_lines{0};
+  // Compare instructions and the lines they jump to
+  std::vector<std::pair<size_t, size_t>> jumps;
+
+  const auto emit = [&program](AROpcode opcode) -> ARInstruction& {
+    ARInstruction& instruction = program.emplace_back();
+    instruction.opcode = opcode;
+    return instruction;
+  };
+  const auto emit_interpret = [&emit](size_t line, u32 line_count) {
+    ARInstruction& instruction = emit(AROpcode::Interpret);
+    instruction.line = static_cast<u32>(line);
+    instruction.line_count = line_count;
+  };
+  while (!pending_lines.empty())
+  {
+    size_t line = pending_lines.back();
+    pending_lines.pop_back();
+    if (line < ops.size() && line_starts[line])
+      continue;
+
+    // Compile lines in order until the code ends or reaches a line that has been compiled already.
+    bool done = false;
+    while (!done)
+    {
+      if (line >= ops.size())
+      {
+        emit(AROpcode::End);
+        break;
+      }
+      if (line_starts[line])
+      {
+        emit(AROpcode::Jump).target = *line_starts[line];
+        break;
+      }
+      line_starts[line] = static_cast<u32>(program.size());
+
+      const ARAddr addr(ops[line].cmd_addr);
+      const u32 data = ops[line].value;
+
+      // ActionReplay program self modification codes
+      if (addr >= 0x00002000 && addr < 0x00003000)
+      {
+        emit_interpret(line, 1);
+        break;
+      }
+
+      // Zero codes
+      if (0x0 == addr)
+      {
+        switch (data >> 29)
+        {
+        case ZCODE_END:
+          emit(AROpcode::End);
+          done = true;
+          break;
+
+        case ZCODE_NORM:
+          ++line;
+          break;
+
+        case ZCODE_04:
+        {
+          // The next line holds the parameters
+          if (line + 1 >= ops.size())
+          {
+            emit(AROpcode::End);
+            done = true;
+            break;
+          }
+
+          const ARAddr next_addr(ops[line + 1].cmd_addr);
+          const u32 next_data = ops[line + 1].value;
+          if (0x3 == ((data >> 25) & 0x03))
+          {
+            if ((next_data & 0xFF0000) != 0)
+            {
+              emit_interpret(line, 2);
+              done = true;
+              break;
+            }
+
+            ARInstruction& copy = emit((next_data >> 24) != 0x0 ? AROpcode::MemoryCopyWithPointers :
+                                                                  AROpcode::MemoryCopy);
+            copy.address = next_addr.GCAddress();
+            copy.destination = data & ~0x06000000;
+            copy.count = static_cast<u8>(next_data & 0x7FFF);
+          }
+          else
+          {
+            const u32 size = ARAddr(data).size;
+            if (size == DATATYPE_32BIT_FLOAT)
+            {
+              emit_interpret(line, 2);
+              done = true;
+              break;
+            }
+
+            ARInstruction& fill = emit(AROpcode::FillAndSlide);
+            fill.size = GetSizeInBytes(size);
+            fill.address = ARAddr(data).GCAddress();
+            fill.value = next_addr;
+            fill.count = static_cast<u8>((next_data & 0xFF0000) >> 16);
+            fill.address_step = static_cast<s16>(next_data & 0xFFFF) * fill.size;
+            fill.value_step = static_cast<s8>(next_data >> 24);
+          }
+          line += 2;
+          break;
+        }
+
+        default:
+          emit_interpret(line, 1);
+          done = true;
+          break;
+        }
+        continue;
+      }
+
+      // Normal codes
+      if (addr.type == 0x00)
+      {
+        switch (addr.subtype)
+        {
+        case SUB_RAM_WRITE:
+        {
+          ARInstruction& write = emit(AROpcode::Write);
+          write.size = GetSizeInBytes(addr.size);
+          write.address = addr.GCAddress();
+          write.value = data;
+          write.count = 1;
+          if (addr.size == DATATYPE_8BIT)
+            write.count = (data >> 8) + 1;
+          else if (addr.size == DATATYPE_16BIT)
+            write.count = (data >> 16) + 1;
+          write.address_step = write.size;
+          break;
+        }
+
+        case SUB_WRITE_POINTER:
+        {
+          ARInstruction& write = emit(AROpcode::WriteToPointer);
+          write.size = GetSizeInBytes(addr.size);
+          write.address = addr.GCAddress();
+          write.value = data;
+          if (addr.size == DATATYPE_8BIT)
+            write.offset = data >> 8;
+          else if (addr.size == DATATYPE_16BIT)
+            write.offset = (data >> 16) << 1;
+          break;
+        }
+
+        case SUB_ADD_CODE:
+        {
+          ARInstruction& add =
+              emit(addr.size == DATATYPE_32BIT_FLOAT ? AROpcode::AddFloat : AROpcode::Add);
+          add.size = GetSizeInBytes(addr.size);
+          add.address = addr.GCAddress();
+          add.value = data;
+          break;
+        }
+
+        default:
+          emit_interpret(line, 1);
+          done = true;
+          break;
+        }
+        ++line;
+        continue;
+      }
+
+      // Conditional codes
+      ARInstruction& compare = emit(AROpcode::Compare);
+      compare.size = GetSizeInBytes(addr.size);
+      compare.compare_type = static_cast<u8>(addr.type);
+      compare.address = addr.GCAddress();
+      compare.value = compare.size == 1 ? (data & 0xFF) : compare.size == 2 ? (data & 0xFFFF) : data;
+      compare.target = ARInstruction::END_OF_CODE;
+
+      std::optional<size_t> target_line;
+      switch (addr.subtype)
+      {
+      case CONDTIONAL_ONE_LINE:
+      case CONDTIONAL_TWO_LINES:
+        target_line = line + 1 + addr.subtype + 1;
+        break;
+
+      case CONDTIONAL_ALL_LINES_UNTIL:
+        // Skip lines until a "00000000 40000000" line has been skipped
+        for (size_t i = line + 1; i < ops.size(); ++i)
+        {
+          if (ops[i].cmd_addr == 0 && ops[i].value == 0x40000000)
+          {
+            target_line = i + 1;
+            break;
+          }
+        }
+        break;
+
+      case CONDTIONAL_ALL_LINES:
+        break;
+      }
+
+      if (target_line && *target_line < ops.size())
+      {
+        jumps.emplace_back(program.size() - 1, *target_line);
+        pending_lines.push_back(*target_line);
+      }
+      ++line;
+    }
+  }
+
+  for (const auto& [instruction, target_line] : jumps)
+    program[instruction].target = *line_starts[target_line];
+
+  return program;
+}
+
+// Returns where the given range of effective memory is in host memory, or nullptr if accesses have
+// to go through the MMU (e.g. for memchecks or the data cache).
+static u8* GetHostPointer(const Core::CPUThreadGuard& guard, u32 address, u32 size)
+{
+  // Keep the range within one BAT page so that it's contiguous in physical memory.
+  if ((address & (PowerPC::BAT_PAGE_SIZE - 1)) + size > PowerPC::BAT_PAGE_SIZE)
+    return nullptr;
+
+  auto& system = guard.GetSystem();
+  auto& mmu = system.GetMMU();
+  if (!mmu.IsOptimizableRAMAddress(address, size * 8))
+    return nullptr;
+
+  const std::optional<u32> physical_address = mmu.GetTranslatedAddress(address);
+  if (!physical_address)
+    return nullptr;
+  return system.GetMemory().GetPointerForRange(*physical_address, size);
+}
+
+template <typename T>
+static T ReadValue(const Core::CPUThreadGuard& guard, u32 address)
+{
+  const u8* host_pointer = GetHostPointer(guard, address, sizeof(T));
+  if (!host_pointer)
+    return PowerPC::MMU::HostRead<T>(guard, address);
+
+  T value;
+  std::memcpy(&value, host_pointer, sizeof(T));
+  return Common::FromBigEndian(value);
+}
+
+// Equivalent to ApplyMemoryPatch, but writes directly to RAM when possible.
+template <typename T>
+static void WriteValue(const Core::CPUThreadGuard& guard, u32 address, T value)
+{
+  u8* host_pointer = GetHostPointer(guard, address, sizeof(T));
+  if (!host_pointer)
+  {
+    ApplyMemoryPatch<T>(guard, value, address);
+    return;
+  }
+
+  const Common::BigEndianValue<T> big_endian{value};
+  if (std::memcmp(host_pointer, &big_endian, sizeof(T)) == 0)
+    return;
+  std::memcpy(host_pointer, &big_endian, sizeof(T));
+
+  // The code might have patched instructions.
+  auto& power_pc = guard.GetSystem().GetPowerPC();
+  const u32 first_word = Common::AlignDown(address, 4);
+  const u32 last_word = Common::AlignDown(address + static_cast<u32>(sizeof(T)) - 1, 4);
+  power_pc.ScheduleInvalidateCacheThreadSafe(first_word);
+  if (last_word != first_word)
+    power_pc.ScheduleInvalidateCacheThreadSafe(last_word);
+}
+
+static u32 ReadValue(const Core::CPUThreadGuard& guard, u32 address, u8 size)
+{
+  switch (size)
+  {
+  case 1:
+    return ReadValue<u8>(guard, address);
+  case 2:
+    return ReadValue<u16>(guard, address);
+  default:
+    return ReadValue<u32>(guard, address);
+  }
+}
+
+static void WriteValue(const Core::CPUThreadGuard& guard, u32 address, u32 value, u8 size)
+{
+  switch (size)
+  {
+  case 1:
+    WriteValue<u8>(guard, address, static_cast<u8>(value));
+    break;
+  case 2:
+    WriteValue<u16>(guard, address, static_cast<u16>(value));
+    break;
+  default:
+    WriteValue<u32>(guard, address, value);
+    break;
+  }
+}
+
+static bool RunCompiledCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcode,
+                                  std::span<const ARInstruction> program)
+{
+  size_t pc = 0;
+  while (true)
+  {
+    const ARInstruction& instruction = program[pc++];
+    switch (instruction.opcode)
+    {
+    case AROpcode::Write:
+      for (u32 i = 0; i < instruction.count; ++i)
+      {
+        WriteValue(guard, instruction.address + i * instruction.address_step, instruction.value,
+                   instruction.size);
+      }
+      break;
+
+    case AROpcode::WriteToPointer:
+    {
+      const u32 pointer = ReadValue<u32>(guard, instruction.address);
+      WriteValue(guard, pointer + instruction.offset, instruction.value, instruction.size);
+      break;
+    }
+
+    case AROpcode::Add:
+      WriteValue(guard, instruction.address,
+                 ReadValue(guard, instruction.address, instruction.size) + instruction.value,
+                 instruction.size);
+      break;
+
+    case AROpcode::AddFloat:
+    {
+      const float value = std::bit_cast<float>(ReadValue<u32>(guard, instruction.address)) +
+                          static_cast<float>(instruction.value);
+      WriteValue<u32>(guard, instruction.address, std::bit_cast<u32>(value));
+      break;
+    }
+
+    case AROpcode::FillAndSlide:
+    {
+      u32 address = instruction.address;
+      u32 value = instruction.value;
+      for (u32 i = 0; i < instruction.count; ++i)
+      {
+        WriteValue(guard, address, value, instruction.size);
+        address += instruction.address_step;
+        value += instruction.value_step;
+      }
+      break;
+    }
+
+    case AROpcode::MemoryCopy:
+    case AROpcode::MemoryCopyWithPointers:
+    {
+      u32 source = instruction.address;
+      u32 destination = instruction.destination;
+      if (instruction.opcode == AROpcode::MemoryCopyWithPointers)
+      {
+        destination = ReadValue<u32>(guard, destination);
+        source = ReadValue<u32>(guard, source);
+      }
+      for (u32 i = 0; i < instruction.count; ++i)
+        WriteValue<u8>(guard, destination + i, ReadValue<u8>(guard, source + i));
+      break;
+    }
+
+    case AROpcode::Compare:
+      if (!CompareValues(ReadValue(guard, instruction.address, instruction.size),
+                         instruction.value, instruction.compare_type))
+      {
+        if (instruction.target == ARInstruction::END_OF_CODE)
+          return true;
+        pc = instruction.target;
+      }
+      break;
+
+    case AROpcode::Jump:
+      pc = instruction.target;
+      break;
+
+    case AROpcode::End:
+      return true;
+
+    case AROpcode::Interpret:
+      return InterpretCodeLocked(
+          guard, arcode,
+          std::span(arcode.ops).subspan(instruction.line, instruction.line_count));
+    }
+  }
+}
+
 void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
 {
   if (!Config::AreCheatsEnabled())
@@ -1012,12 +1496,39 @@ void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard guard(s_lock);
-  std::erase_if(s_active_codes, [&cpu_guard](const ARCode& code) {
-    const bool success = RunCodeLocked(cpu_guard, code);
-    LogInfo("\n");
-    return !success;
-  });
-  s_disable_logging = true;
+
+  // The first run after the codes have changed is interpreted, so that it can be logged.
+  if (!s_disable_logging)
+  {
+    s_compiled_codes.clear();
+    std::erase_if(s_active_codes, [&cpu_guard](const ARCode& code) {
+      const bool success = InterpretCodeLocked(cpu_guard, code, code.ops);
+      LogInfo("\n");
+      return !success;
+    });
+    s_disable_logging = true;
+    return;
+  }
+
+  for (size_t i = s_compiled_codes.size(); i < s_active_codes.size(); ++i)
+    s_compiled_codes.push_back(CompileCode(s_active_codes[i]));
+
+  size_t kept = 0;
+  for (size_t i = 0; i < s_active_codes.size(); ++i)
+  {
+    s_current_code = &s_active_codes[i];
+    if (!RunCompiledCodeLocked(cpu_guard, s_active_codes[i], s_compiled_codes[i]))
+      continue;
+
+    if (kept != i)
+    {
+      s_active_codes[kept] = std::move(s_active_codes[i]);
+      s_compiled_codes[kept] = std::move(s_compiled_codes[i]);
+    }
+    ++kept;
+  }
+  s_active_codes.resize(kept);
+  s_compiled_codes.resize(kept);
 }
 
 }  // namespace ActionReplay
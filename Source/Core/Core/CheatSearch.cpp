@@ -3,7 +3,9 @@
 
 #include "Core/CheatSearch.h"
 
+#include <algorithm>
 #include <bit>
+#include <cstring>
 #include <expected>
 #include <functional>
 #include <memory>
@@ -16,6 +18,7 @@
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Core.h"
@@ -110,11 +113,115 @@ TryReadValueFromEmulatedMemory(const Core::CPUThreadGuard& guard, u32 addr,
 }
 
 template <typename T>
-auto Cheats::NewSearch(const Core::CPUThreadGuard& guard,
-                       std::span<const Cheats::MemoryRange> memory_ranges,
-                       PowerPC::RequestedAddressSpace address_space, bool aligned,
-                       const std::function<bool(const T& value)>& validator)
-    -> std::expected<std::vector<SearchResult<T>>, SearchErrorCode>
+static T ReadHostValue(const u8* data)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return Common::FromBigEndian(value);
+}
+
+// Whether reads in the given address space go through address translation.
+static bool IsTranslated(const Core::CPUThreadGuard& guard,
+                         PowerPC::RequestedAddressSpace address_space)
+{
+  switch (address_space)
+  {
+  case PowerPC::RequestedAddressSpace::Effective:
+    return guard.GetSystem().GetPPCState().msr.DR;
+  case PowerPC::RequestedAddressSpace::Physical:
+    return false;
+  case PowerPC::RequestedAddressSpace::Virtual:
+    return true;
+  }
+  return false;
+}
+
+template <typename T>
+static void AddSearchResult(std::vector<Cheats::SearchResult<T>>* results, u32 address, T value,
+                            bool translated)
+{
+  auto& r = results->emplace_back();
+  r.m_value = value;
+  r.m_value_state = translated ? Cheats::SearchResultValueState::ValueFromVirtualMemory :
+                                 Cheats::SearchResultValueState::ValueFromPhysicalMemory;
+  r.m_address = address;
+}
+
+// Checks count values starting at first_address, which must all lie within the given host page.
+template <typename T, typename Validator>
+static void SearchHostPage(const u8* page, u32 page_address, u32 first_address, u32 increment,
+                           u64 count, bool translated, const Validator& validator,
+                           std::vector<Cheats::SearchResult<T>>* results)
+{
+  const u8* const first = page + (first_address - page_address);
+
+  // Matches are first gathered into a bitmask, which keeps the comparison loop free of branches
+  // so that the compiler can vectorize it. Most values don't match, so the bitmask is usually 0.
+  for (u64 base = 0; base < count; base += 64)
+  {
+    const u64 block_count = std::min<u64>(64, count - base);
+    u64 matches = 0;
+    for (u64 i = 0; i < block_count; ++i)
+    {
+      const T value = ReadHostValue<T>(first + (base + i) * increment);
+      matches |= static_cast<u64>(validator(value)) << i;
+    }
+
+    while (matches != 0)
+    {
+      const u64 index = base + std::countr_zero(matches);
+      matches &= matches - 1;
+      AddSearchResult<T>(results, static_cast<u32>(first_address + index * increment),
+                         ReadHostValue<T>(first + index * increment), translated);
+    }
+  }
+}
+
+// Checks the values at start_address + i for i = 0, increment, 2 * increment... below length.
+template <typename T, typename Validator>
+static void SearchMemoryRange(const Core::CPUThreadGuard& guard, u32 start_address, u64 length,
+                              u32 increment, PowerPC::RequestedAddressSpace address_space,
+                              const Validator& validator,
+                              std::vector<Cheats::SearchResult<T>>* results)
+{
+  const bool translated = IsTranslated(guard, address_space);
+
+  u64 i = 0;
+  while (i < length)
+  {
+    const u64 address = start_address + i;
+    const u64 page_address = address & ~u64{PowerPC::HW_PAGE_MASK};
+    const u64 page_end = page_address + PowerPC::HW_PAGE_SIZE;
+    const u64 last_address_in_page = page_end - sizeof(T);
+
+    // Values that lie entirely within the page are read from host memory in bulk.
+    const u8* page =
+        PowerPC::MMU::HostGetPagePointer(guard, static_cast<u32>(page_address), address_space);
+    if (page && address <= last_address_in_page)
+    {
+      const u64 end = std::min(length, last_address_in_page - start_address + 1);
+      const u64 count = (end - i + increment - 1) / increment;
+      SearchHostPage<T>(page, static_cast<u32>(page_address), static_cast<u32>(address),
+                        increment, count, translated, validator, results);
+      i += count * increment;
+    }
+
+    // Values that cross into the next page, or all values if the page can't be read directly.
+    for (; i < length && start_address + i < page_end; i += increment)
+    {
+      const u32 addr = static_cast<u32>(start_address + i);
+      const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+      if (current_value && validator(current_value->value))
+        AddSearchResult<T>(results, addr, current_value->value, current_value->translated);
+    }
+  }
+}
+
+template <typename T, typename Validator>
+static std::expected<std::vector<Cheats::SearchResult<T>>, Cheats::SearchErrorCode>
+NewSearchImpl(const Core::CPUThreadGuard& guard, std::span<const Cheats::MemoryRange> memory_ranges,
+              PowerPC::RequestedAddressSpace address_space, bool aligned,
+              const Validator& validator)
 {
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return std::unexpected{Cheats::SearchErrorCode::DisabledInHardcoreMode};
@@ -141,33 +248,17 @@ auto Cheats::NewSearch(const Core::CPUThreadGuard& guard,
       continue;
 
     const u64 length = aligned_length - (sizeof(T) - 1);
-    for (u64 i = 0; i < length; i += increment_per_loop)
-    {
-      const u32 addr = start_address + i;
-      const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
-      if (!current_value)
-        continue;
-
-      if (validator(current_value->value))
-      {
-        auto& r = results.emplace_back();
-        r.m_value = current_value->value;
-        r.m_value_state = current_value->translated ?
-                              Cheats::SearchResultValueState::ValueFromVirtualMemory :
-                              Cheats::SearchResultValueState::ValueFromPhysicalMemory;
-        r.m_address = addr;
-      }
-    }
+    SearchMemoryRange<T>(guard, start_address, length, increment_per_loop, address_space,
+                         validator, &results);
   }
   return results;
 }
 
-template <typename T>
-auto Cheats::NextSearch(
-    const Core::CPUThreadGuard& guard, std::span<const Cheats::SearchResult<T>> previous_results,
-    PowerPC::RequestedAddressSpace address_space,
-    const std::function<bool(const T& new_value, const T& old_value)>& validator)
-    -> std::expected<std::vector<SearchResult<T>>, SearchErrorCode>
+template <typename T, typename Validator>
+static std::expected<std::vector<Cheats::SearchResult<T>>, Cheats::SearchErrorCode>
+NextSearchImpl(const Core::CPUThreadGuard& guard,
+               std::span<const Cheats::SearchResult<T>> previous_results,
+               PowerPC::RequestedAddressSpace address_space, const Validator& validator)
 {
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return std::unexpected{Cheats::SearchErrorCode::DisabledInHardcoreMode};
@@ -181,10 +272,35 @@ auto Cheats::NextSearch(
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return std::unexpected{Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible};
 
+  results.reserve(previous_results.size());
+  const bool translated = IsTranslated(guard, address_space);
+
+  // Results are sorted by address, so consecutive results usually share a page.
+  std::optional<u32> cached_page_address;
+  const u8* cached_page = nullptr;
+
   for (const auto& previous_result : previous_results)
   {
     const u32 addr = previous_result.m_address;
-    const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+
+    std::optional<PowerPC::ReadResult<T>> current_value;
+    if ((addr & PowerPC::HW_PAGE_MASK) <= PowerPC::HW_PAGE_SIZE - sizeof(T))
+    {
+      const u32 page_address = addr & ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+      if (cached_page_address != page_address)
+      {
+        cached_page_address = page_address;
+        cached_page = PowerPC::MMU::HostGetPagePointer(guard, page_address, address_space);
+      }
+      if (cached_page)
+      {
+        current_value.emplace(translated,
+                              ReadHostValue<T>(cached_page + (addr & PowerPC::HW_PAGE_MASK)));
+      }
+    }
+    if (!current_value)
+      current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+
     if (!current_value)
     {
       auto& r = results.emplace_back();
@@ -196,18 +312,31 @@ auto Cheats::NextSearch(
     // if the previous state was invalid we always update the value to avoid getting stuck in an
     // invalid state
     if (!previous_result.IsValueValid() || validator(current_value->value, previous_result.m_value))
-    {
-      auto& r = results.emplace_back();
-      r.m_value = current_value->value;
-      r.m_value_state = current_value->translated ?
-                            Cheats::SearchResultValueState::ValueFromVirtualMemory :
-                            Cheats::SearchResultValueState::ValueFromPhysicalMemory;
-      r.m_address = addr;
-    }
+      AddSearchResult<T>(&results, addr, current_value->value, current_value->translated);
   }
   return results;
 }
 
+template <typename T>
+auto Cheats::NewSearch(const Core::CPUThreadGuard& guard,
+                       std::span<const Cheats::MemoryRange> memory_ranges,
+                       PowerPC::RequestedAddressSpace address_space, bool aligned,
+                       const std::function<bool(const T& value)>& validator)
+    -> std::expected<std::vector<SearchResult<T>>, SearchErrorCode>
+{
+  return NewSearchImpl<T>(guard, memory_ranges, address_space, aligned, validator);
+}
+
+template <typename T>
+auto Cheats::NextSearch(
+    const Core::CPUThreadGuard& guard, std::span<const Cheats::SearchResult<T>> previous_results,
+    PowerPC::RequestedAddressSpace address_space,
+    const std::function<bool(const T& new_value, const T& old_value)>& validator)
+    -> std::expected<std::vector<SearchResult<T>>, SearchErrorCode>
+{
+  return NextSearchImpl<T>(guard, previous_results, address_space, validator);
+}
+
 Cheats::CheatSearchSessionBase::~CheatSearchSessionBase() = default;
 
 template <typename T>
@@ -292,51 +421,29 @@ void Cheats::CheatSearchSession<T>::RemoveResult(size_t index)
   }
 }
 
-template <typename T>
-static std::function<bool(const T& new_value)>
-MakeCompareFunctionForSpecificValue(Cheats::CompareType op, const T& old_value)
-{
-  switch (op)
-  {
-  case Cheats::CompareType::Equal:
-    return [&](const T& new_value) { return new_value == old_value; };
-  case Cheats::CompareType::NotEqual:
-    return [&](const T& new_value) { return new_value != old_value; };
-  case Cheats::CompareType::Less:
-    return [&](const T& new_value) { return new_value < old_value; };
-  case Cheats::CompareType::LessOrEqual:
-    return [&](const T& new_value) { return new_value <= old_value; };
-  case Cheats::CompareType::Greater:
-    return [&](const T& new_value) { return new_value > old_value; };
-  case Cheats::CompareType::GreaterOrEqual:
-    return [&](const T& new_value) { return new_value >= old_value; };
-  default:
-    DEBUG_ASSERT(false);
-    return nullptr;
-  }
-}
-
-template <typename T>
-static std::function<bool(const T& old_value, const T& new_value)>
-MakeCompareFunctionForLastValue(Cheats::CompareType op)
+// Calls f with a comparison function object of a concrete type (rather than a std::function), so
+// that the search loops can be inlined and vectorized.
+template <typename T, typename F>
+static std::expected<std::vector<Cheats::SearchResult<T>>, Cheats::SearchErrorCode>
+VisitCompareFunction(Cheats::CompareType op, const F& f)
 {
   switch (op)
   {
   case Cheats::CompareType::Equal:
-    return std::equal_to<T>();
+    return f(std::equal_to<T>());
   case Cheats::CompareType::NotEqual:
-    return std::not_equal_to<T>();
+    return f(std::not_equal_to<T>());
   case Cheats::CompareType::Less:
-    return std::less<T>();
+    return f(std::less<T>());
   case Cheats::CompareType::LessOrEqual:
-    return std::less_equal<T>();
+    return f(std::less_equal<T>());
   case Cheats::CompareType::Greater:
-    return std::greater<T>();
+    return f(std::greater<T>());
   case Cheats::CompareType::GreaterOrEqual:
-    return std::greater_equal<T>();
+    return f(std::greater_equal<T>());
   default:
     DEBUG_ASSERT(false);
-    return nullptr;
+    return std::unexpected{Cheats::SearchErrorCode::InvalidParameters};
   }
 }
 
@@ -352,37 +459,39 @@ Cheats::SearchErrorCode Cheats::CheatSearchSession<T>::RunSearch(const Core::CPU
     if (!m_value)
       return Cheats::SearchErrorCode::InvalidParameters;
 
-    auto func = MakeCompareFunctionForSpecificValue<T>(m_compare_type, *m_value);
-    if (m_first_search_done)
-    {
-      result = Cheats::NextSearch<T>(
-          guard, m_search_results, m_address_space,
-          [&func](const T& new_value, const T& old_value) { return func(new_value); });
-    }
-    else
-    {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned, func);
-    }
+    const T value = *m_value;
+    result = VisitCompareFunction<T>(m_compare_type, [&](const auto compare) {
+      if (m_first_search_done)
+      {
+        return NextSearchImpl<T>(
+            guard, std::span<const SearchResult<T>>(m_search_results), m_address_space,
+            [&](const T& new_value, const T& old_value) { return compare(new_value, value); });
+      }
+      return NewSearchImpl<T>(guard, m_memory_ranges, m_address_space, m_aligned,
+                              [&](const T& new_value) { return compare(new_value, value); });
+    });
   }
   else if (m_filter_type == FilterType::CompareAgainstLastValue)
   {
     if (!m_first_search_done)
       return Cheats::SearchErrorCode::InvalidParameters;
 
-    result = Cheats::NextSearch<T>(guard, m_search_results, m_address_space,
-                                   MakeCompareFunctionForLastValue<T>(m_compare_type));
+    result = VisitCompareFunction<T>(m_compare_type, [&](const auto compare) {
+      return NextSearchImpl<T>(guard, std::span<const SearchResult<T>>(m_search_results),
+                               m_address_space, compare);
+    });
   }
   else if (m_filter_type == FilterType::DoNotFilter)
   {
     if (m_first_search_done)
     {
-      result = Cheats::NextSearch<T>(guard, m_search_results, m_address_space,
-                                     [](const T& v1, const T& v2) { return true; });
+      result = NextSearchImpl<T>(guard, std::span<const SearchResult<T>>(m_search_results),
+                                 m_address_space, [](const T& v1, const T& v2) { return true; });
     }
     else
     {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned,
-                                    [](const T& v) { return true; });
+      result = NewSearchImpl<T>(guard, m_memory_ranges, m_address_space, m_aligned,
+                                [](const T& v) { return true; });
     }
   }
 
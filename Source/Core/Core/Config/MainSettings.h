@@ -62,6 +62,7 @@ extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_PAGE_TABLE_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
+extern const Info<bool> MAIN_EXPORT_SHARED_MEMORY;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
@@ -175,6 +176,8 @@ extern const Info<bool> MAIN_WII_WIILINK_ENABLE;
 // Main.DSP
 
 extern const Info<bool> MAIN_DSP_THREAD;
+extern const Info<bool> MAIN_DSP_HLE_THREAD;
+extern const Info<int> MAIN_DSP_HLE_MIXER_THREADS;
 extern const Info<bool> MAIN_DSP_CAPTURE_LOG;
 extern const Info<bool> MAIN_DSP_JIT;
 extern const Info<bool> MAIN_DUMP_AUDIO;
@@ -56,6 +56,7 @@
 #include "Core/HW/GCKeyboard.h"
 #include "Core/HW/GCPad.h"
 #include "Core/HW/HW.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/Wiimote.h"
@@ -166,6 +167,8 @@ void FrameUpdateOnCPUThread()
 
 void OnFrameEnd(Core::System& system)
 {
+  system.GetMemory().AdvanceSharedMemoryExportFrame();
+
 #ifdef USE_MEMORYWATCHER
   if (s_memory_watcher)
   {
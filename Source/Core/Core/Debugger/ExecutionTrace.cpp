@@ -0,0 +1,170 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Debugger/ExecutionTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <zstd.h>
+
+#include "Common/Assert.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Core/Core.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/System.h"
+
+namespace Core
+{
+namespace
+{
+// Traces are large and written while the game is running, so favor speed over ratio.
+constexpr int TRACE_ZSTD_LEVEL = 1;
+}  // namespace
+
+ExecutionTrace::~ExecutionTrace()
+{
+  StopWriterThread();
+}
+
+bool ExecutionTrace::Start(const CPUThreadGuard& guard, const std::string& path,
+                           bool record_memory_accesses)
+{
+  if (!Open(path, record_memory_accesses))
+    return false;
+
+  guard.GetSystem().GetJitInterface().ClearCache(guard);
+  return true;
+}
+
+bool ExecutionTrace::Open(const std::string& path, bool record_memory_accesses)
+{
+  if (m_recording_active)
+    return false;
+
+  File::CreateFullPath(path);
+  m_file.Open(path, "wb");
+  const ExecutionTraceFileHeader header;
+  if (!m_file || !m_file.WriteArray(&header, 1))
+  {
+    ERROR_LOG_FMT(POWERPC, "Failed to open execution trace file {}", path);
+    m_file.Close();
+    return false;
+  }
+
+  m_ring_buffer = std::make_unique<ExecutionTraceRecord[]>(RING_BUFFER_RECORDS);
+  m_write_index.store(0, std::memory_order_relaxed);
+  m_read_index.store(0, std::memory_order_relaxed);
+  m_cached_read_index = 0;
+  m_stop_writer = false;
+  m_chunk_ready.Reset();
+  m_writer_thread = std::thread(&ExecutionTrace::WriterThread, this);
+
+  m_recording_active = true;
+  m_recording_memory_accesses = record_memory_accesses;
+
+  INFO_LOG_FMT(POWERPC, "Started recording an execution trace to {}", path);
+  return true;
+}
+
+void ExecutionTrace::Stop(const CPUThreadGuard& guard)
+{
+  if (!m_recording_active)
+    return;
+
+  Shutdown();
+  guard.GetSystem().GetJitInterface().ClearCache(guard);
+}
+
+void ExecutionTrace::Shutdown()
+{
+  m_recording_active = false;
+  m_recording_memory_accesses = false;
+  StopWriterThread();
+}
+
+void ExecutionTrace::StopWriterThread()
+{
+  if (!m_writer_thread.joinable())
+    return;
+
+  m_stop_writer = true;
+  m_chunk_ready.Set();
+  m_writer_thread.join();
+
+  INFO_LOG_FMT(POWERPC, "Stopped recording an execution trace after {} records",
+               m_write_index.load(std::memory_order_relaxed));
+  m_file.Close();
+  m_ring_buffer.reset();
+}
+
+void ExecutionTrace::WaitForSpace(u64 write_index)
+{
+  // The ring buffer is full. Rather than dropping records, which would make the trace useless for
+  // offline analysis, stall the CPU thread until the writer has caught up.
+  while (true)
+  {
+    m_cached_read_index = m_read_index.load(std::memory_order_acquire);
+    if (write_index - m_cached_read_index < RING_BUFFER_RECORDS)
+      return;
+
+    m_chunk_ready.Set();
+    std::this_thread::yield();
+  }
+}
+
+void ExecutionTrace::WriterThread()
+{
+  Common::SetCurrentThreadName("Execution Trace Writer");
+
+  bool write_failed = false;
+  while (true)
+  {
+    // Read the stop flag first, so that every record pushed before it was set gets written.
+    const bool stop = m_stop_writer.load(std::memory_order_acquire);
+    const u64 end = m_write_index.load(std::memory_order_acquire);
+    u64 begin = m_read_index.load(std::memory_order_relaxed);
+
+    // Only whole chunks are written while recording, so a chunk never wraps around the ring buffer.
+    while (end - begin >= CHUNK_RECORDS || (stop && begin != end))
+    {
+      const u64 chunk_end = std::min(begin + CHUNK_RECORDS, end);
+      if (!write_failed && !WriteChunk(begin, chunk_end))
+      {
+        ERROR_LOG_FMT(POWERPC, "Failed to write execution trace, discarding further records");
+        write_failed = true;
+      }
+      begin = chunk_end;
+      m_read_index.store(begin, std::memory_order_release);
+    }
+
+    if (stop)
+      return;
+
+    // Partial chunks are left in the ring buffer until they fill up or recording stops.
+    m_chunk_ready.WaitFor(std::chrono::milliseconds(100));
+  }
+}
+
+bool ExecutionTrace::WriteChunk(u64 begin, u64 end)
+{
+  const size_t offset = begin % RING_BUFFER_RECORDS;
+  const size_t record_count = end - begin;
+  ASSERT(offset + record_count <= RING_BUFFER_RECORDS);
+
+  const size_t uncompressed_size = record_count * sizeof(ExecutionTraceRecord);
+  std::vector<u8> compressed(ZSTD_compressBound(uncompressed_size));
+  const size_t compressed_size =
+      ZSTD_compress(compressed.data(), compressed.size(), &m_ring_buffer[offset],
+                    uncompressed_size, TRACE_ZSTD_LEVEL);
+  if (ZSTD_isError(compressed_size))
+    return false;
+
+  const ExecutionTraceChunkHeader header{static_cast<u32>(record_count),
+                                         static_cast<u32>(compressed_size)};
+  return m_file.WriteArray(&header, 1) && m_file.WriteBytes(compressed.data(), compressed_size);
+}
+}  // namespace Core
@@ -0,0 +1,135 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/IOFile.h"
+
+namespace Core
+{
+class CPUThreadGuard;
+
+// Trace file layout (all values little endian):
+//   ExecutionTraceFileHeader
+//   repeated: ExecutionTraceChunkHeader, followed by a zstd frame holding record_count records
+enum class ExecutionTraceRecordType : u32
+{
+  BlockEntry = 0,
+  Load = 1,
+  Store = 2,
+};
+
+struct ExecutionTraceRecord
+{
+  ExecutionTraceRecordType type;
+  // The PC of the block for BlockEntry, the effective address for Load and Store.
+  u32 address;
+};
+static_assert(sizeof(ExecutionTraceRecord) == 8);
+
+struct ExecutionTraceFileHeader
+{
+  static constexpr u32 MAGIC = 0x43525444;  // "DTRC"
+  static constexpr u32 VERSION = 1;
+
+  u32 magic = MAGIC;
+  u32 version = VERSION;
+};
+
+struct ExecutionTraceChunkHeader
+{
+  u32 record_count;
+  u32 compressed_size;
+};
+
+// Records which JIT blocks are entered, and optionally the effective addresses of loads and
+// stores, into a compact binary file. Unlike CodeTrace, which single steps and disassembles every
+// instruction, the records are emitted by the JIT, so games keep running at close to full speed.
+//
+// The CPU thread is the only producer of a single-producer single-consumer ring buffer, which a
+// background thread compresses and writes to the file.
+class ExecutionTrace final
+{
+public:
+  ExecutionTrace() = default;
+  ~ExecutionTrace();
+
+  ExecutionTrace(const ExecutionTrace&) = delete;
+  ExecutionTrace(ExecutionTrace&&) = delete;
+  ExecutionTrace& operator=(const ExecutionTrace&) = delete;
+  ExecutionTrace& operator=(ExecutionTrace&&) = delete;
+
+  bool GetRecordingActive() const { return m_recording_active; }
+  bool GetRecordingMemoryAccesses() const { return m_recording_memory_accesses; }
+
+  // Both of these clear the JIT cache so that blocks are recompiled with or without the records.
+  bool Start(const CPUThreadGuard& guard, const std::string& path, bool record_memory_accesses);
+  void Stop(const CPUThreadGuard& guard);
+
+  // Like Start() and Stop(), without touching the JIT. Shutdown() is used when the JIT is being
+  // shut down.
+  bool Open(const std::string& path, bool record_memory_accesses);
+  void Shutdown();
+
+  // Called by JIT code.
+  static void RecordBlockEntry(ExecutionTrace* trace, u32 address)
+  {
+    trace->Push(ExecutionTraceRecordType::BlockEntry, address);
+  }
+  static void RecordLoad(ExecutionTrace* trace, u32 address)
+  {
+    trace->Push(ExecutionTraceRecordType::Load, address);
+  }
+  static void RecordStore(ExecutionTrace* trace, u32 address)
+  {
+    trace->Push(ExecutionTraceRecordType::Store, address);
+  }
+
+  // The number of records compressed together. The ring buffer holds several chunks so that the
+  // CPU thread can keep running while a chunk is being compressed.
+  static constexpr size_t CHUNK_RECORDS = 64 * 1024;
+  static constexpr size_t RING_BUFFER_RECORDS = 16 * CHUNK_RECORDS;
+
+private:
+  void Push(ExecutionTraceRecordType type, u32 address)
+  {
+    const u64 write_index = m_write_index.load(std::memory_order_relaxed);
+    if (write_index - m_cached_read_index >= RING_BUFFER_RECORDS) [[unlikely]]
+      WaitForSpace(write_index);
+
+    m_ring_buffer[write_index % RING_BUFFER_RECORDS] = {type, address};
+    m_write_index.store(write_index + 1, std::memory_order_release);
+    if ((write_index + 1) % CHUNK_RECORDS == 0)
+      m_chunk_ready.Set();
+  }
+
+  void WaitForSpace(u64 write_index);
+  void WriterThread();
+  bool WriteChunk(u64 begin, u64 end);
+  void StopWriterThread();
+
+  bool m_recording_active = false;
+  bool m_recording_memory_accesses = false;
+
+  std::unique_ptr<ExecutionTraceRecord[]> m_ring_buffer;
+  // Only written by the CPU thread.
+  alignas(64) std::atomic<u64> m_write_index = 0;
+  // The CPU thread's last known value of m_read_index, to avoid touching the writer's cache line.
+  u64 m_cached_read_index = 0;
+  // Only written by the writer thread.
+  alignas(64) std::atomic<u64> m_read_index = 0;
+
+  std::atomic<bool> m_stop_writer = false;
+  Common::Event m_chunk_ready;
+  File::IOFile m_file;
+  std::thread m_writer_thread;
+};
+}  // namespace Core
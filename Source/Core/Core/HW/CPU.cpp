@@ -8,6 +8,7 @@
 #include <queue>
 
 #include "AudioCommon/AudioCommon.h"
+#include "Common/Assert.h"
 #include "Common/Event.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
@@ -129,6 +130,7 @@ void CPUManager::Run()
   {
     m_state_cpu_cvar.wait(state_lock, [this] { return !m_state_paused_and_locked; });
     ExecutePendingJobs(state_lock);
+    ResumeAfterInterruptLocked();
     CPUThreadConfigCallback::CheckForConfigChanges();
 
     Common::Event gdb_step_sync_event;
@@ -245,6 +247,17 @@ void CPUManager::RunSingleFrame()
 
   power_pc.RunLoop();
 
+  std::unique_lock state_lock(m_state_change_lock);
+  while (m_state_resume_after_jobs)
+  {
+    ExecutePendingJobs(state_lock);
+    ResumeAfterInterruptLocked();
+    state_lock.unlock();
+    power_pc.RunLoop();
+    state_lock.lock();
+  }
+  state_lock.unlock();
+
   AsyncRequests::GetInstance()->PullEvents();
 }
 #endif
@@ -324,9 +337,20 @@ bool CPUManager::SetStateLocked(State s)
   if (s == State::Stepping)
     m_system.GetPowerPC().GetBreakPoints().ClearTemporary();
   m_state = s;
+  m_state_resume_after_jobs = false;
   return true;
 }
 
+// Requires holding m_state_change_lock
+void CPUManager::ResumeAfterInterruptLocked()
+{
+  if (!m_state_resume_after_jobs)
+    return;
+
+  m_state_resume_after_jobs = false;
+  m_state = State::Running;
+}
+
 void CPUManager::SetStepping(bool stepping)
 {
   std::lock_guard stepping_lock(m_stepping_lock);
@@ -384,7 +408,7 @@ bool CPUManager::PauseAndLock()
   std::unique_lock state_lock(m_state_change_lock);
   m_state_paused_and_locked = true;
 
-  const bool was_unpaused = m_state == State::Running;
+  const bool was_unpaused = m_state == State::Running || m_state_resume_after_jobs;
   SetStateLocked(State::Stepping);
 
   while (m_state_cpu_thread_active)
@@ -438,4 +462,21 @@ void CPUManager::AddCPUThreadJob(Common::MoveOnlyFunction<void()> function)
   m_pending_jobs.push(std::move(function));
 }
 
+void CPUManager::InterruptWithJob(Common::MoveOnlyFunction<void()> function)
+{
+  ASSERT(Core::IsCPUThread());
+
+  std::unique_lock state_lock(m_state_change_lock);
+  m_pending_jobs.push(std::move(function));
+
+  // The JIT only needs to see a state other than Running to return. SetStateLocked isn't used
+  // since this isn't a real pause: temporary breakpoints must stay, and the state is restored
+  // as soon as the jobs are done.
+  if (m_state == State::Running && !m_state_paused_and_locked)
+  {
+    m_state = State::Stepping;
+    m_state_resume_after_jobs = true;
+  }
+}
+
 }  // namespace CPU
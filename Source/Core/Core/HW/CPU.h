@@ -107,6 +107,12 @@ public:
   // PauseAndLock(), as while the CPU is in the run loop, it won't execute the function.
   void AddCPUThreadJob(Common::MoveOnlyFunction<void()> function);
 
+  // Makes the CPU thread leave the run loop at its next state check, execute the function and
+  // then continue running. Unlike Break(), this doesn't pause the emulation. For System code that
+  // needs to run on the CPU thread outside of JIT code, e.g. to load a state from an event.
+  // This should only be called from the CPU thread.
+  void InterruptWithJob(Common::MoveOnlyFunction<void()> function);
+
 #ifdef __LIBRETRO__
   bool HasCPURunStateBeenReached() const
   {
@@ -119,6 +125,7 @@ private:
   void StartTimePlayedTimer();
   void RunAdjacentSystems(bool running);
   bool SetStateLocked(State s);
+  void ResumeAfterInterruptLocked();
 
   // CPU Thread execution state.
   // Requires m_state_change_lock to modify the value.
@@ -147,6 +154,8 @@ private:
   bool m_state_cpu_thread_active = false;
   bool m_state_paused_and_locked = false;
   bool m_state_system_request_stepping = false;
+  // Set by InterruptWithJob. Cleared by any other change of m_state.
+  bool m_state_resume_after_jobs = false;
   bool m_state_cpu_step_instruction = false;
   Common::Event* m_state_cpu_step_instruction_sync = nullptr;
   std::queue<Common::MoveOnlyFunction<void()>> m_pending_jobs;
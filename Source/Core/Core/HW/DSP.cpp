@@ -33,6 +33,7 @@
 
 #include "Core/CoreTiming.h"
 #include "Core/DSPEmulator.h"
+#include "Core/HW/DSPHLE/DSPHLE.h"
 #include "Core/HW/HSP/HSP.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/Memmap.h"
@@ -102,6 +103,14 @@ void DSPManager::CompleteARAM(u64 userdata, s64 cyclesLate)
   GenerateDSPInterrupt(INT_ARAM, 0);
 }
 
+void DSPManager::GlobalCompleteHLEMails(Core::System& system, u64 userdata, s64 cyclesLate)
+{
+  DSPManager& dsp = system.GetDSP();
+  // MIOS may have switched to LLE since the mails were queued.
+  if (!dsp.m_is_lle)
+    static_cast<HLE::DSPHLE*>(dsp.m_dsp_emulator.get())->SyncMailThread();
+}
+
 DSPEmulator* DSPManager::GetDSPEmulator()
 {
   return m_dsp_emulator.get();
@@ -114,6 +123,8 @@ void DSPManager::Init(bool hle)
   m_event_type_generate_dsp_interrupt =
       core_timing.RegisterEvent("DSPint", GlobalGenerateDSPInterrupt);
   m_event_type_complete_aram = core_timing.RegisterEvent("ARAMint", GlobalCompleteARAM);
+  m_event_type_complete_hle_mails =
+      core_timing.RegisterEvent("DSPHLEMails", GlobalCompleteHLEMails);
 }
 
 void DSPManager::Reinit(bool hle)
@@ -403,6 +414,11 @@ void DSPManager::GenerateDSPInterruptFromDSPEmu(DSPInterruptType type, int cycle
                             CoreTiming::FromThread::ANY);
 }
 
+void DSPManager::ScheduleHLEMailCompletion(int cycles_into_future)
+{
+  m_system.GetCoreTiming().ScheduleEvent(cycles_into_future, m_event_type_complete_hle_mails);
+}
+
 // called whenever SystemTimers thinks the DSP deserves a few more cycles
 void DSPManager::UpdateDSPSlice(int cycles)
 {
@@ -91,6 +91,9 @@ public:
   // TODO: Maybe rethink this? The timing is unpredictable.
   void GenerateDSPInterruptFromDSPEmu(DSPInterruptType type, int cycles_into_future = 0);
 
+  // Called from the CPU thread by DSP HLE, which waits for its mail thread once the event fires.
+  void ScheduleHLEMailCompletion(int cycles_into_future);
+
   // Audio/DSP Helper
   u8 ReadARAM(u32 address) const;
   void WriteARAM(u8 value, u32 address);
@@ -107,6 +110,7 @@ private:
   static void GlobalGenerateDSPInterrupt(Core::System& system, u64 DSPIntType, s64 cyclesLate);
   void CompleteARAM(u64 userdata, s64 cyclesLate);
   static void GlobalCompleteARAM(Core::System& system, u64 userdata, s64 cyclesLate);
+  static void GlobalCompleteHLEMails(Core::System& system, u64 userdata, s64 cyclesLate);
   void UpdateInterrupts();
   void Do_ARAM_DMA();
 
@@ -187,6 +191,7 @@ private:
 
   CoreTiming::EventType* m_event_type_generate_dsp_interrupt = nullptr;
   CoreTiming::EventType* m_event_type_complete_aram = nullptr;
+  CoreTiming::EventType* m_event_type_complete_hle_mails = nullptr;
 
   Core::System& m_system;
 };
@@ -6,6 +6,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
@@ -14,6 +15,11 @@
 
 namespace DSP::HLE
 {
+// How long after a mail is sent the CPU thread waits for the mail thread at the latest, unless the
+// guest reads the mailbox first. Matches the time AX takes for an empty command list, so the
+// interrupt at the end of a command list is raised when handling the mail inline would raise it.
+constexpr int MAIL_THREAD_SYNC_CYCLES = 2500;
+
 DSPHLE::DSPHLE(Core::System& system) : m_mail_handler(system.GetDSP()), m_system(system)
 {
 }
@@ -22,6 +28,14 @@ DSPHLE::~DSPHLE() = default;
 
 bool DSPHLE::Initialize(bool wii, bool dsp_thread)
 {
+  SyncMailThread();
+
+  m_use_mail_thread = dsp_thread && Config::Get(Config::MAIN_DSP_HLE_THREAD);
+  if (m_use_mail_thread)
+    m_mail_thread.Reset("DSP HLE thread");
+  else
+    m_mail_thread.Shutdown();
+
   m_wii = wii;
   m_ucode = nullptr;
   m_last_ucode = nullptr;
@@ -44,11 +58,19 @@ void DSPHLE::DSP_StopSoundStream()
 
 void DSPHLE::Shutdown()
 {
+  SyncMailThread();
+  m_mail_thread.Shutdown();
+  m_use_mail_thread = false;
   m_ucode = nullptr;
 }
 
 void DSPHLE::DSP_Update(int cycles)
 {
+  // Don't stall the CPU thread on a frame that is still being mixed. Update() only deals with
+  // resume mails after ucode switches, so it's fine to retry on the next tick.
+  if (m_mails_in_flight)
+    return;
+
   if (m_ucode != nullptr)
     m_ucode->Update();
 }
@@ -65,10 +87,43 @@ void DSPHLE::SendMailToDSP(u32 mail)
   if (m_ucode != nullptr)
   {
     DEBUG_LOG_FMT(DSP_MAIL, "CPU writes {:#010x}", mail);
-    m_ucode->HandleMail(mail);
+
+    // The mail thread timing is reproducible, but differs from handling mails inline, and the
+    // setting isn't synced between NetPlay peers or stored in movies. WantsDeterminism can change
+    // at runtime (NetPlay).
+    if (!m_use_mail_thread || Core::WantsDeterminism())
+    {
+      SyncMailThread();
+      m_ucode->HandleMail(mail);
+      return;
+    }
+
+    // The mail thread starts on the mail right away, and the CPU keeps running until the guest
+    // reads the mailbox or the sync event scheduled for the first mail in flight fires.
+    if (!m_mails_in_flight)
+    {
+      m_mails_in_flight = true;
+      m_system.GetDSP().ScheduleHLEMailCompletion(MAIL_THREAD_SYNC_CYCLES);
+    }
+
+    // The ucode may be swapped by a previous mail, so m_ucode has to be read on the mail thread.
+    m_mail_thread.Push([this, mail, sent_ticks = m_system.GetCoreTiming().GetTicks()] {
+      m_mail_handler.DeferInterrupts(sent_ticks);
+      m_ucode->HandleMail(mail);
+    });
   }
 }
 
+void DSPHLE::SyncMailThread()
+{
+  if (!m_mails_in_flight)
+    return;
+
+  m_mail_thread.WaitForCompletion();
+  m_mails_in_flight = false;
+  m_mail_handler.RaiseDeferredInterrupts(m_system.GetCoreTiming().GetTicks());
+}
+
 void DSPHLE::SetUCode(u32 crc)
 {
   m_mail_handler.ClearPending();
@@ -98,6 +153,8 @@ void DSPHLE::SwapUCode(u32 crc)
 
 void DSPHLE::DoState(PointerWrap& p)
 {
+  SyncMailThread();
+
   bool is_hle = true;
   p.Do(is_hle);
   if (!is_hle && p.IsReadMode())
@@ -148,6 +205,7 @@ u16 DSPHLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
   }
   else
   {
+    SyncMailThread();
     return AccessMailHandler().ReadDSPMailboxHigh();
   }
 }
@@ -160,6 +218,7 @@ u16 DSPHLE::DSP_ReadMailBoxLow(bool cpu_mailbox)
   }
   else
   {
+    SyncMailThread();
     return AccessMailHandler().ReadDSPMailboxLow();
   }
 }
@@ -194,6 +253,8 @@ void DSPHLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 // Other DSP functions
 u16 DSPHLE::DSP_WriteControlRegister(u16 value)
 {
+  SyncMailThread();
+
   DSP::UDSPControl temp(value);
 
   if (m_dsp_control.DSPHalt != temp.DSPHalt)
@@ -244,6 +305,7 @@ u16 DSPHLE::DSP_ReadControlRegister()
 
 void DSPHLE::PauseAndLock()
 {
+  SyncMailThread();
 }
 
 void DSPHLE::UnpauseAndUnlock()
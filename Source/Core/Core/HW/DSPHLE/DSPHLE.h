@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/DSPEmulator.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
@@ -53,6 +54,11 @@ public:
 
   Core::System& GetSystem() const { return m_system; }
 
+  // Waits for the mail thread to handle the mails in flight, then raises the interrupts they
+  // requested. Called when the guest reads the mailbox, from the sync event scheduled when the
+  // mails were sent, and before the CPU thread touches the ucode or the mail handler.
+  void SyncMailThread();
+
 private:
   void SendMailToDSP(u32 mail);
 
@@ -79,6 +85,15 @@ private:
   u64 m_control_reg_init_code_clear_time = 0;
   CMailHandler m_mail_handler;
 
+  // Optional thread which runs the ucode mail handlers, including all of the audio mixing, while
+  // the CPU keeps running. Like the real DSP, the ucodes then access RAM and ARAM concurrently with
+  // the CPU; games leave the buffers they handed to the DSP alone until it signals completion, and
+  // that interrupt is only raised after the CPU thread has synced with the mail thread.
+  Common::AsyncWorkThreadSP m_mail_thread;
+  bool m_use_mail_thread = false;
+  // Whether mails have been pushed to the mail thread since the last sync.
+  bool m_mails_in_flight = false;
+
   Core::System& m_system;
 };
 }  // namespace DSP::HLE
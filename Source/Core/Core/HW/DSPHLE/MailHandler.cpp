@@ -24,7 +24,10 @@ void CMailHandler::PushMail(u32 mail, bool interrupt, int cycles_into_future)
   {
     if (m_pending_mails.empty())
     {
-      m_dsp.GenerateDSPInterruptFromDSPEmu(DSP::INT_DSP, cycles_into_future);
+      if (m_defer_interrupts)
+        m_deferred_interrupts.push_back(m_deferred_sent_ticks + cycles_into_future);
+      else
+        m_dsp.GenerateDSPInterruptFromDSPEmu(DSP::INT_DSP, cycles_into_future);
     }
     else
     {
@@ -68,6 +71,25 @@ u16 CMailHandler::ReadDSPMailboxLow()
   return u16(m_last_mail & 0xffff);
 }
 
+void CMailHandler::DeferInterrupts(u64 sent_ticks)
+{
+  m_defer_interrupts = true;
+  m_deferred_sent_ticks = sent_ticks;
+}
+
+void CMailHandler::RaiseDeferredInterrupts(u64 current_ticks)
+{
+  // Interrupts that would already have fired had the mail been handled inline are raised now.
+  for (const u64 due_ticks : m_deferred_interrupts)
+  {
+    const int cycles_into_future =
+        due_ticks > current_ticks ? static_cast<int>(due_ticks - current_ticks) : 0;
+    m_dsp.GenerateDSPInterruptFromDSPEmu(DSP::INT_DSP, cycles_into_future);
+  }
+  m_deferred_interrupts.clear();
+  m_defer_interrupts = false;
+}
+
 void CMailHandler::ClearPending()
 {
   m_pending_mails.clear();
@@ -5,6 +5,7 @@
 
 #include <deque>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -42,6 +43,12 @@ public:
   u16 ReadDSPMailboxHigh();
   u16 ReadDSPMailboxLow();
 
+  // While the DSP HLE mail thread handles a mail, the interrupts the ucode requests are collected
+  // instead of being scheduled, and raised afterwards by the CPU thread with
+  // RaiseDeferredInterrupts. Their delays count from sent_ticks, the time the CPU sent the mail.
+  void DeferInterrupts(u64 sent_ticks);
+  void RaiseDeferredInterrupts(u64 current_ticks);
+
 private:
   // The actual DSP only has a single pair of mail registers, and doesn't keep track of pending
   // mails. But for HLE, it's a lot easier to write all the mails that will be read ahead of time,
@@ -53,6 +60,11 @@ private:
   // When halted, the DSP itself is not running, but the last mail can be read.
   bool m_halted = false;
 
+  bool m_defer_interrupts = false;
+  u64 m_deferred_sent_ticks = 0;
+  // The tick each interrupt requested while deferring is due at.
+  std::vector<u64> m_deferred_interrupts;
+
   DSP::DSPManager& m_dsp;
 };
 }  // namespace DSP::HLE
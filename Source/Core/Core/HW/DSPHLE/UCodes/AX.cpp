@@ -6,6 +6,8 @@
 #include <array>
 #include <cstring>
 #include <iterator>
+#include <span>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -14,6 +16,7 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
@@ -27,7 +30,9 @@
 
 namespace DSP::HLE
 {
-AXUCode::AXUCode(DSPHLE* dsphle, u32 crc, bool dummy) : UCodeInterface(dsphle, crc)
+AXUCode::AXUCode(DSPHLE* dsphle, u32 crc, bool dummy)
+    : UCodeInterface(dsphle, crc),
+      m_voice_mixer(static_cast<u32>(Config::Get(Config::MAIN_DSP_HLE_MIXER_THREADS)))
 {
 }
 
@@ -36,6 +41,8 @@ AXUCode::AXUCode(DSPHLE* dsphle, u32 crc) : AXUCode(dsphle, crc, false)
   INFO_LOG_FMT(DSPHLE, "Instantiating AXUCode: crc={:08x}", crc);
 
   m_accelerator = std::make_unique<HLEAccelerator>(dsphle->GetSystem().GetDSP());
+  for (u32 i = 1; i < m_voice_mixer.GetThreadCount(); ++i)
+    m_voice_accelerators.push_back(std::make_unique<HLEAccelerator>(dsphle->GetSystem().GetDSP()));
 }
 
 AXUCode::~AXUCode() = default;
@@ -461,35 +468,55 @@ void AXUCode::ProcessPBList(u32 pb_addr)
   // 32KHz to 48KHz, but AX always process at 32KHz.
   constexpr u32 spms = 32;
 
-  AXPB pb;
+  struct Voice
+  {
+    u32 addr;
+    AXPB pb;
+    PBUpdateData updates;
+  };
+  std::vector<Voice> voices;
 
+  // Voices don't depend on each other, so read the whole list first and mix them in parallel.
   auto& memory = m_dsphle->GetSystem().GetMemory();
   while (pb_addr)
   {
-    AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
-                          m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
-                          m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround}};
-
-    ReadPB(memory, pb_addr, pb);
-
-    PBUpdateData updates = LoadPBUpdates(memory, pb);
+    Voice& voice = voices.emplace_back();
+    voice.addr = pb_addr;
+    ReadPB(memory, pb_addr, voice.pb);
+    voice.updates = LoadPBUpdates(memory, voice.pb);
 
+    // Updates can change the link to the next PB too.
+    AXPB updated_pb = voice.pb;
     for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
-    {
-      ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
-
-      ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
-                   ConvertMixerControl(pb.mixer_control),
-                   m_coeffs_checksum ? m_coeffs.data() : nullptr, false);
+      ApplyUpdatesForMs(curr_ms, updated_pb, updated_pb.updates.num_updates, voice.updates);
+    pb_addr = HILO_TO_32(updated_pb.next_pb);
+  }
 
-      // Forward the buffers
-      for (auto& ptr : buffers.ptrs)
-        ptr += spms;
-    }
+  const std::array<std::span<int>, 9> outputs{
+      m_samples_main_left, m_samples_main_right, m_samples_main_surround,
+      m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
+      m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround,
+  };
 
-    WritePB(memory, pb_addr, pb);
-    pb_addr = HILO_TO_32(pb.next_pb);
-  }
+  MixVoices(m_voice_mixer, static_cast<HLEAccelerator*>(m_accelerator.get()),
+            m_voice_accelerators, voices.size(), outputs,
+            [&](HLEAccelerator* accelerator, size_t index, AXBuffers buffers, AXQuirks& quirks) {
+              AXPB& pb = voices[index].pb;
+              for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
+              {
+                ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, voices[index].updates);
+
+                ProcessVoice(accelerator, pb, buffers, spms, ConvertMixerControl(pb.mixer_control),
+                             m_coeffs_checksum ? m_coeffs.data() : nullptr, false, quirks);
+
+                // Forward the buffers
+                for (auto& ptr : buffers.ptrs)
+                  ptr += spms;
+              }
+            });
+
+  for (const Voice& voice : voices)
+    WritePB(memory, voice.addr, voice.pb);
 }
 
 void AXUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr)
@@ -14,11 +14,13 @@
 #include <array>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
 #include "Core/HW/DSPHLE/DSPHLE.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceMixer.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -111,6 +113,11 @@ protected:
 
   std::unique_ptr<Accelerator> m_accelerator;
 
+  // Voices are mixed on m_voice_mixer's threads, each of which but the first needs its own
+  // accelerator.
+  AXVoiceMixer m_voice_mixer;
+  std::vector<std::unique_ptr<Accelerator>> m_voice_accelerators;
+
   // Constructs without any GC-specific state, so it can be used by the deriving AXWii.
   AXUCode(DSPHLE* dsphle, u32 crc, bool dummy);
 
@@ -13,15 +13,20 @@
 
 #include <algorithm>
 #include <bit>
+#include <array>
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <span>
 
+#include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceMixer.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
@@ -138,6 +143,21 @@ public:
 
   PB_TYPE* acc_pb = nullptr;
 
+  // Copies the registers of an accelerator which was used on another mixer thread.
+  void CopyRegistersFrom(const HLEAccelerator& other)
+  {
+    m_start_address = other.m_start_address;
+    m_end_address = other.m_end_address;
+    m_current_address = other.m_current_address;
+    m_sample_format.hex = other.m_sample_format.hex;
+    m_gain = other.m_gain;
+    m_yn1 = other.m_yn1;
+    m_yn2 = other.m_yn2;
+    m_pred_scale = other.m_pred_scale;
+    m_input = other.m_input;
+    m_reads_stopped = other.m_reads_stopped;
+  }
+
 protected:
   void OnRawReadEndException() override {}
   void OnRawWriteEndException() override {}
@@ -421,10 +441,36 @@ static void BiquadFilter(s16* samples, u32 count, PBBiquadFilter& f)
 }
 #endif
 
+// Game quirks noticed while mixing voices. Analytics must not be touched from the mixer threads, so
+// ProcessVoice only records them, and MixVoices reports them once every voice has been mixed.
+struct AXQuirks
+{
+  bool initial_time_delay = false;
+  bool wiimote_biquad = false;
+  bool wiimote_low_pass = false;
+
+  void Merge(const AXQuirks& other)
+  {
+    initial_time_delay |= other.initial_time_delay;
+    wiimote_biquad |= other.wiimote_biquad;
+    wiimote_low_pass |= other.wiimote_low_pass;
+  }
+
+  void Report() const
+  {
+    if (initial_time_delay)
+      DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::UsesAXInitialTimeDelay);
+    if (wiimote_biquad)
+      DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::UsesAXWiimoteBiquad);
+    if (wiimote_low_pass)
+      DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::UsesAXWiimoteLowPass);
+  }
+};
+
 // Process 1ms of audio (for AX GC) or 3ms of audio (for AX Wii) from a PB and
 // mix it to the output buffers.
 void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buffers, u16 count,
-                  AXMixControl mctrl, const s16* coeffs, bool new_filter)
+                  AXMixControl mctrl, const s16* coeffs, bool new_filter, AXQuirks& quirks)
 {
   // If the voice is not running, nothing to do.
   if (pb.running != 1)
@@ -541,7 +587,7 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   if (pb.initial_time_delay.on)
   {
     // TODO
-    DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::UsesAXInitialTimeDelay);
+    quirks.initial_time_delay = true;
   }
 
 #ifdef AX_WII
@@ -553,12 +599,12 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
       // Only one filter at most for Wiimotes.
       if (pb.remote_iir.on == 2)
       {
-        DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::UsesAXWiimoteBiquad);
+        quirks.wiimote_biquad = true;
         BiquadFilter(samples, count, pb.remote_iir.biquad);
       }
       else
       {
-        DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::UsesAXWiimoteLowPass);
+        quirks.wiimote_low_pass = true;
         LowPassFilter(samples, count, pb.remote_iir.lpf);
       }
     }
@@ -610,6 +656,59 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 #endif
 }
 
+// Mixes voice_count voices with the voice mixer. mix_voice(accelerator, index, buffers, quirks) is
+// called for every voice and must only touch the state of that voice and `quirks`.
+//
+// Each mixer thread reads samples through its own accelerator. The accelerator registers are
+// savestated, so afterwards the main accelerator is left in the state of the one which read the
+// last voice, exactly like when mixing on a single thread.
+template <typename MixVoiceFunction>
+void MixVoices(AXVoiceMixer& mixer, HLEAccelerator* accelerator,
+               std::span<const std::unique_ptr<Accelerator>> thread_accelerators,
+               size_t voice_count, std::span<const std::span<int>> outputs,
+               const MixVoiceFunction& mix_voice)
+{
+  constexpr size_t buffer_count = sizeof(AXBuffers) / sizeof(int*);
+  static_assert(buffer_count <= AXVoiceMixer::MAX_BUFFERS);
+  ASSERT(outputs.size() == buffer_count);
+
+  const u32 thread_count = mixer.GetThreadCountFor(voice_count);
+  const auto get_accelerator = [&](u32 thread) {
+    return thread == 0 ? accelerator :
+                         static_cast<HLEAccelerator*>(thread_accelerators[thread - 1].get());
+  };
+  for (u32 thread = 1; thread < thread_count; ++thread)
+  {
+    get_accelerator(thread)->CopyRegistersFrom(*accelerator);
+    get_accelerator(thread)->acc_pb = nullptr;
+  }
+
+  std::array<AXQuirks, AXVoiceMixer::MAX_THREADS> thread_quirks{};
+  mixer.Mix(voice_count, outputs,
+            [&](u32 thread, size_t begin, size_t end, std::span<int* const> buffer_ptrs) {
+              AXBuffers buffers;
+              std::memcpy(&buffers, buffer_ptrs.data(), sizeof(buffers));
+              HLEAccelerator* const thread_accelerator = get_accelerator(thread);
+              for (size_t i = begin; i < end; ++i)
+                mix_voice(thread_accelerator, i, buffers, thread_quirks[thread]);
+            });
+
+  AXQuirks quirks;
+  for (u32 thread = 0; thread < thread_count; ++thread)
+    quirks.Merge(thread_quirks[thread]);
+  quirks.Report();
+
+  // AcceleratorSetup sets acc_pb, so it tells whether a thread has read any samples.
+  for (u32 thread = thread_count - 1; thread > 0; --thread)
+  {
+    if (get_accelerator(thread)->acc_pb != nullptr)
+    {
+      accelerator->CopyRegistersFrom(*get_accelerator(thread));
+      break;
+    }
+  }
+}
+
 }  // namespace
 }  // inline namespace AXGC/AXWii
 }  // namespace DSP::HLE
@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXVoiceMixer.h"
+
+#include <algorithm>
+#include <array>
+
+#include "Common/Assert.h"
+#include "Common/WorkQueueThread.h"
+
+namespace DSP::HLE
+{
+struct AXVoiceMixer::Worker
+{
+  Common::AsyncWorkThreadSP thread{"AX mixer thread"};
+  std::vector<std::vector<int>> buffers;
+  std::vector<int*> buffer_ptrs;
+};
+
+AXVoiceMixer::AXVoiceMixer(u32 thread_count)
+    : m_thread_count(std::clamp<u32>(thread_count, 1, MAX_THREADS))
+{
+  for (u32 i = 1; i < m_thread_count; ++i)
+    m_workers.push_back(std::make_unique<Worker>());
+}
+
+AXVoiceMixer::~AXVoiceMixer() = default;
+
+u32 AXVoiceMixer::GetThreadCountFor(size_t voice_count) const
+{
+  return static_cast<u32>(
+      std::clamp<size_t>(voice_count / MIN_VOICES_PER_THREAD, 1, m_thread_count));
+}
+
+void AXVoiceMixer::Mix(size_t voice_count, std::span<const std::span<int>> outputs,
+                       const MixFunction& mix)
+{
+  ASSERT(outputs.size() <= MAX_BUFFERS);
+
+  std::array<int*, MAX_BUFFERS> output_ptrs{};
+  for (size_t i = 0; i < outputs.size(); ++i)
+    output_ptrs[i] = outputs[i].data();
+  const std::span<int* const> main_buffers(output_ptrs.data(), outputs.size());
+
+  const u32 thread_count = GetThreadCountFor(voice_count);
+  if (thread_count == 1)
+  {
+    mix(0, 0, voice_count, main_buffers);
+    return;
+  }
+
+  for (u32 thread = 1; thread < thread_count; ++thread)
+  {
+    Worker& worker = *m_workers[thread - 1];
+    worker.buffers.resize(outputs.size());
+    worker.buffer_ptrs.resize(outputs.size());
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+      worker.buffers[i].assign(outputs[i].size(), 0);
+      worker.buffer_ptrs[i] = worker.buffers[i].data();
+    }
+
+    const size_t begin = voice_count * thread / thread_count;
+    const size_t end = voice_count * (thread + 1) / thread_count;
+    worker.thread.Push(
+        [&mix, &worker, thread, begin, end] { mix(thread, begin, end, worker.buffer_ptrs); });
+  }
+
+  mix(0, 0, voice_count / thread_count, main_buffers);
+
+  for (u32 thread = 1; thread < thread_count; ++thread)
+  {
+    Worker& worker = *m_workers[thread - 1];
+    worker.thread.WaitForCompletion();
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+      std::ranges::transform(outputs[i], worker.buffers[i], outputs[i].begin(),
+                             [](int a, int b) { return a + b; });
+    }
+  }
+}
+}  // namespace DSP::HLE
@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace DSP::HLE
+{
+// Mixes the voices of an AX frame on several threads.
+//
+// The voice list is split into contiguous ranges, one per thread. The first range is mixed on the
+// calling thread directly into the output buffers. The other threads mix into private buffers,
+// which are added to the outputs in thread order once they are done. Voices are only ever summed
+// as integers, so the output doesn't depend on the number of threads.
+class AXVoiceMixer
+{
+public:
+  // Mixes the voices [begin, end) into `buffers`, which holds one pointer per output buffer.
+  // `thread` is 0 for the calling thread.
+  using MixFunction =
+      std::function<void(u32 thread, size_t begin, size_t end, std::span<int* const> buffers)>;
+
+  // Don't bother waking up other threads for less voices than this.
+  static constexpr size_t MIN_VOICES_PER_THREAD = 8;
+  static constexpr u32 MAX_THREADS = 16;
+  static constexpr size_t MAX_BUFFERS = 20;
+
+  explicit AXVoiceMixer(u32 thread_count);
+  AXVoiceMixer(const AXVoiceMixer&) = delete;
+  AXVoiceMixer& operator=(const AXVoiceMixer&) = delete;
+  ~AXVoiceMixer();
+
+  u32 GetThreadCount() const { return m_thread_count; }
+
+  // Returns the number of threads Mix uses for the given number of voices.
+  u32 GetThreadCountFor(size_t voice_count) const;
+
+  void Mix(size_t voice_count, std::span<const std::span<int>> outputs, const MixFunction& mix);
+
+private:
+  struct Worker;
+
+  u32 m_thread_count;
+  std::vector<std::unique_ptr<Worker>> m_workers;
+};
+}  // namespace DSP::HLE
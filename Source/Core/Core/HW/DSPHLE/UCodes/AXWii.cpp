@@ -6,6 +6,9 @@
 #include "Core/HW/DSPHLE/UCodes/AXWii.h"
 
 #include <array>
+#include <optional>
+#include <span>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -32,6 +35,8 @@ AXWiiUCode::AXWiiUCode(DSPHLE* dsphle, u32 crc)
   m_new_filter = crc == 0x347112ba || crc == 0x4cc52064;
 
   m_accelerator = std::make_unique<HLEAccelerator>(dsphle->GetSystem().GetDSP());
+  for (u32 i = 1; i < m_voice_mixer.GetThreadCount(); ++i)
+    m_voice_accelerators.push_back(std::make_unique<HLEAccelerator>(dsphle->GetSystem().GetDSP()));
 }
 
 void AXWiiUCode::Initialize()
@@ -437,49 +442,92 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
   // 32KHz to 48KHz, but AX always process at 32KHz.
   constexpr u32 spms = 32;
 
-  AXPBWii pb;
+  struct Voice
+  {
+    u32 addr;
+    AXPBWii pb;
+    std::optional<PBUpdateData> updates;
+  };
+  std::vector<Voice> voices;
 
+  // Voices don't depend on each other, so read the whole list first and mix them in parallel.
   auto& memory = m_dsphle->GetSystem().GetMemory();
   while (pb_addr)
   {
-    AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
-                          m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
-                          m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround,
-                          m_samples_auxC_left, m_samples_auxC_right, m_samples_auxC_surround,
-                          m_samples_wm0,       m_samples_aux0,       m_samples_wm1,
-                          m_samples_aux1,      m_samples_wm2,        m_samples_aux2,
-                          m_samples_wm3,       m_samples_aux3}};
-
-    ReadPB(memory, pb_addr, pb);
-
-    if (m_old_axwii &&
-        (pb.updates.num_updates[0] | pb.updates.num_updates[1] | pb.updates.num_updates[2]))
+    Voice& voice = voices.emplace_back();
+    voice.addr = pb_addr;
+    ReadPB(memory, pb_addr, voice.pb);
+
+    if (m_old_axwii && (voice.pb.updates.num_updates[0] | voice.pb.updates.num_updates[1] |
+                        voice.pb.updates.num_updates[2]))
     {
-      PBUpdateData updates = LoadPBUpdates(memory, pb);
+      voice.updates = LoadPBUpdates(memory, voice.pb);
+
+      // Updates can change the link to the next PB too.
+      AXPBWii updated_pb = voice.pb;
       for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
-      {
-        ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
-        ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
-                     ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
-                     m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter);
-
-        // Forward the buffers
-        for (auto& ptr : buffers.regular_ptrs)
-          ptr += spms;
-        for (auto& ptr : buffers.wiimote_ptrs)
-          ptr += 6;
-      }
+        ApplyUpdatesForMs(curr_ms, updated_pb, updated_pb.updates.num_updates, *voice.updates);
+      pb_addr = HILO_TO_32(updated_pb.next_pb);
     }
     else
     {
-      ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, 96,
-                   ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
-                   m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter);
+      pb_addr = HILO_TO_32(voice.pb.next_pb);
     }
-
-    WritePB(memory, pb_addr, pb);
-    pb_addr = HILO_TO_32(pb.next_pb);
   }
+
+  const std::array<std::span<int>, 20> outputs{
+      std::span<int>(m_samples_main_left, 32 * 3),
+      std::span<int>(m_samples_main_right, 32 * 3),
+      std::span<int>(m_samples_main_surround, 32 * 3),
+      std::span<int>(m_samples_auxA_left, 32 * 3),
+      std::span<int>(m_samples_auxA_right, 32 * 3),
+      std::span<int>(m_samples_auxA_surround, 32 * 3),
+      std::span<int>(m_samples_auxB_left, 32 * 3),
+      std::span<int>(m_samples_auxB_right, 32 * 3),
+      std::span<int>(m_samples_auxB_surround, 32 * 3),
+      std::span<int>(m_samples_auxC_left),
+      std::span<int>(m_samples_auxC_right),
+      std::span<int>(m_samples_auxC_surround),
+      std::span<int>(m_samples_wm0),
+      std::span<int>(m_samples_aux0),
+      std::span<int>(m_samples_wm1),
+      std::span<int>(m_samples_aux1),
+      std::span<int>(m_samples_wm2),
+      std::span<int>(m_samples_aux2),
+      std::span<int>(m_samples_wm3),
+      std::span<int>(m_samples_aux3),
+  };
+
+  MixVoices(m_voice_mixer, static_cast<HLEAccelerator*>(m_accelerator.get()),
+            m_voice_accelerators, voices.size(), outputs,
+            [&](HLEAccelerator* accelerator, size_t index, AXBuffers buffers, AXQuirks& quirks) {
+              AXPBWii& pb = voices[index].pb;
+              if (voices[index].updates)
+              {
+                for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
+                {
+                  ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, *voices[index].updates);
+                  ProcessVoice(accelerator, pb, buffers, spms,
+                               ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
+                               m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter, quirks);
+
+                  // Forward the buffers
+                  for (auto& ptr : buffers.regular_ptrs)
+                    ptr += spms;
+                  for (auto& ptr : buffers.wiimote_ptrs)
+                    ptr += 6;
+                }
+              }
+              else
+              {
+                ProcessVoice(accelerator, pb, buffers, 96,
+                             ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
+                             m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter, quirks);
+              }
+            });
+
+  for (const Voice& voice : voices)
+    WritePB(memory, voice.addr, voice.pb);
 }
 
 void AXWiiUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr, u16 volume)
@@ -1856,10 +1856,14 @@ void ZeldaAudioRenderer::DecodeAFC(VPB* vpb, s16* dst, size_t block_count)
         nibble = s16(nibble << 14) >> 1;
     }
 
+    // The predictor saturates every sample before feeding it back, so the recurrence has to stay
+    // serial. Only the coefficient lookups are hoisted out of it.
+    const s32 coef1 = m_afc_coeffs[idx * 2];
+    const s32 coef2 = m_afc_coeffs[idx * 2 + 1];
     s32 yn1 = *vpb->AFCYN1(), yn2 = *vpb->AFCYN2();
     for (s16 nibble : nibbles)
     {
-      s32 sample = delta * nibble + yn1 * m_afc_coeffs[idx * 2] + yn2 * m_afc_coeffs[idx * 2 + 1];
+      s32 sample = delta * nibble + yn1 * coef1 + yn2 * coef2;
       sample >>= 11;
       sample = std::clamp(sample, -0x8000, 0x7fff);
       *dst++ = (s16)sample;
@@ -3,11 +3,11 @@
 
 #pragma once
 
-#include <algorithm>
 #include <array>
 
 #include "Common/CommonTypes.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
+#include "Core/HW/DSPHLE/UCodes/ZeldaMixing.h"
 
 namespace Core
 {
@@ -58,13 +58,7 @@ private:
   template <size_t N, size_t B>
   static void ApplyVolumeInPlace(std::array<s16, N>* buf, u16 vol)
   {
-    for (size_t i = 0; i < N; ++i)
-    {
-      s32 tmp = (u32)(*buf)[i] * (u32)vol;
-      tmp >>= 16 - B;
-
-      (*buf)[i] = (s16)std::clamp(tmp, -0x8000, 0x7FFF);
-    }
+    ZeldaMixing::ApplyVolumeInPlace(buf->data(), N, vol, 16 - B);
   }
   template <size_t N>
   void ApplyVolumeInPlace_1_15(std::array<s16, N>* buf, u16 vol)
@@ -86,27 +80,14 @@ private:
   static s32 AddBuffersWithVolumeRamp(std::array<s16, N>* dst, const std::array<s16, N>& src,
                                       s32 vol, s32 step)
   {
-    if (!vol && !step)
-      return vol;
-
-    for (size_t i = 0; i < N; ++i)
-    {
-      (*dst)[i] += ((vol >> 16) * src[i]) >> 16;
-      vol += step;
-    }
-
-    return vol;
+    return ZeldaMixing::AddBuffersWithVolumeRamp(dst->data(), src.data(), N, vol, step);
   }
 
   // Does not use std::array because it needs to be able to process partial
   // buffers. Volume is in 1.15 format.
   static void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
   {
-    while (count--)
-    {
-      s32 vol_src = ((s32)*src++ * (s32)vol) >> 15;
-      *dst++ += std::clamp(vol_src, -0x8000, 0x7FFF);
-    }
+    ZeldaMixing::AddBuffersWithVolume(dst, src, count, vol);
   }
 
   // Whether the frame needs to be prepared or not.
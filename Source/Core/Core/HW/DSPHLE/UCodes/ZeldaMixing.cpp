@@ -0,0 +1,155 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/ZeldaMixing.h"
+
+#include <algorithm>
+
+#ifdef _M_X86_64
+#include <emmintrin.h>
+#endif
+
+namespace DSP::HLE::ZeldaMixing
+{
+namespace Generic
+{
+void ApplyVolumeInPlace(s16* buf, size_t count, u16 vol, u32 shift)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    s32 tmp = (u32)buf[i] * (u32)vol;
+    tmp >>= shift;
+
+    buf[i] = (s16)std::clamp(tmp, -0x8000, 0x7FFF);
+  }
+}
+
+s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step)
+{
+  if (!vol && !step)
+    return vol;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    dst[i] += ((vol >> 16) * src[i]) >> 16;
+    vol = static_cast<s32>(static_cast<u32>(vol) + static_cast<u32>(step));
+  }
+
+  return vol;
+}
+
+void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
+{
+  while (count--)
+  {
+    s32 vol_src = ((s32)*src++ * (s32)vol) >> 15;
+    *dst++ += std::clamp(vol_src, -0x8000, 0x7FFF);
+  }
+}
+}  // namespace Generic
+
+#ifdef _M_X86_64
+// Computes the full 32-bit products of eight signed samples and an unsigned 16-bit volume.
+// _mm_mulhi_epi16 treats a volume >= 0x8000 as (vol - 0x10000), which takes exactly one
+// sample off the high half. `sign_fix` is all ones in that case to add it back.
+static void MultiplyByVolume(__m128i samples, __m128i vol, __m128i sign_fix, __m128i* lo,
+                             __m128i* hi)
+{
+  const __m128i prod_lo = _mm_mullo_epi16(samples, vol);
+  const __m128i prod_hi =
+      _mm_add_epi16(_mm_mulhi_epi16(samples, vol), _mm_and_si128(samples, sign_fix));
+  *lo = _mm_unpacklo_epi16(prod_lo, prod_hi);
+  *hi = _mm_unpackhi_epi16(prod_lo, prod_hi);
+}
+
+static __m128i VolumeSignFix(u16 vol)
+{
+  return (vol & 0x8000) ? _mm_set1_epi16(-1) : _mm_setzero_si128();
+}
+
+void ApplyVolumeInPlace(s16* buf, size_t count, u16 vol, u32 shift)
+{
+  const __m128i v = _mm_set1_epi16(static_cast<s16>(vol));
+  const __m128i sign_fix = VolumeSignFix(vol);
+  const __m128i shift_count = _mm_cvtsi32_si128(static_cast<int>(shift));
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i* const ptr = reinterpret_cast<__m128i*>(buf + i);
+    __m128i lo, hi;
+    MultiplyByVolume(_mm_loadu_si128(ptr), v, sign_fix, &lo, &hi);
+    lo = _mm_sra_epi32(lo, shift_count);
+    hi = _mm_sra_epi32(hi, shift_count);
+    _mm_storeu_si128(ptr, _mm_packs_epi32(lo, hi));
+  }
+
+  Generic::ApplyVolumeInPlace(buf + i, count - i, vol, shift);
+}
+
+s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step)
+{
+  if (!vol && !step)
+    return vol;
+
+  // Volumes of lanes 0-3 and 4-7. Wraps around like the scalar version.
+  const u32 ustep = static_cast<u32>(step);
+  __m128i vol_lo = _mm_add_epi32(_mm_set1_epi32(vol), _mm_setr_epi32(0, static_cast<s32>(ustep),
+                                                                    static_cast<s32>(ustep * 2),
+                                                                    static_cast<s32>(ustep * 3)));
+  __m128i vol_hi = _mm_add_epi32(vol_lo, _mm_set1_epi32(static_cast<s32>(ustep * 4)));
+  const __m128i step8 = _mm_set1_epi32(static_cast<s32>(ustep * 8));
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    // vol >> 16 always fits in 16 bits, so the pack never saturates. The high half of the signed
+    // 16x16 product is the product shifted right by 16.
+    const __m128i v = _mm_packs_epi32(_mm_srai_epi32(vol_lo, 16), _mm_srai_epi32(vol_hi, 16));
+    const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i* const d = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(d, _mm_add_epi16(_mm_loadu_si128(d), _mm_mulhi_epi16(v, s)));
+
+    vol_lo = _mm_add_epi32(vol_lo, step8);
+    vol_hi = _mm_add_epi32(vol_hi, step8);
+  }
+
+  return Generic::AddBuffersWithVolumeRamp(dst + i, src + i, count - i, _mm_cvtsi128_si32(vol_lo),
+                                           step);
+}
+
+void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
+{
+  const __m128i v = _mm_set1_epi16(static_cast<s16>(vol));
+  const __m128i sign_fix = VolumeSignFix(vol);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i lo, hi;
+    MultiplyByVolume(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), v, sign_fix, &lo,
+                     &hi);
+    const __m128i scaled = _mm_packs_epi32(_mm_srai_epi32(lo, 15), _mm_srai_epi32(hi, 15));
+    __m128i* const d = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(d, _mm_add_epi16(_mm_loadu_si128(d), scaled));
+  }
+
+  Generic::AddBuffersWithVolume(dst + i, src + i, count - i, vol);
+}
+#else
+void ApplyVolumeInPlace(s16* buf, size_t count, u16 vol, u32 shift)
+{
+  Generic::ApplyVolumeInPlace(buf, count, vol, shift);
+}
+
+s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step)
+{
+  return Generic::AddBuffersWithVolumeRamp(dst, src, count, vol, step);
+}
+
+void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
+{
+  Generic::AddBuffersWithVolume(dst, src, count, vol);
+}
+#endif
+}  // namespace DSP::HLE::ZeldaMixing
@@ -0,0 +1,34 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// Mixing primitives of the Zelda ucode audio renderer.
+//
+// The functions in the top-level namespace use SIMD where available. Their output is bit-identical
+// to the Generic implementations, which are kept as the reference.
+namespace DSP::HLE::ZeldaMixing
+{
+// Multiplies every sample by an unsigned fixed point volume, shifts the product right by `shift`
+// and saturates the result to 16 bits.
+void ApplyVolumeInPlace(s16* buf, size_t count, u16 vol, u32 shift);
+
+// Adds ((vol >> 16) * src[i]) >> 16 to every dst[i], with wraparound. The volume is incremented by
+// `step` after every sample. Returns the volume after the last sample.
+s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step);
+
+// Adds the saturated value of (src[i] * vol) >> 15 to every dst[i], with wraparound. The volume is
+// in 1.15 format.
+void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol);
+
+namespace Generic
+{
+void ApplyVolumeInPlace(s16* buf, size_t count, u16 vol, u32 shift);
+s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step);
+void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol);
+}  // namespace Generic
+}  // namespace DSP::HLE::ZeldaMixing
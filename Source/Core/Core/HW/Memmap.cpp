@@ -10,10 +10,12 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
 #include <cstring>
 #include <map>
 #include <memory>
+#include <new>
 #include <set>
 #include <span>
 #include <tuple>
@@ -35,8 +37,10 @@
 #include "Core/HW/MemoryInterface.h"
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/HW/SI/SI.h"
+#include "Core/HW/SharedMemoryExport.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
+#include "Core/PowerPC/BreakPoints.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -144,7 +148,8 @@ void MemoryManager::Init()
     region.active = true;
     mem_size += region.size;
   }
-  m_arena.GrabSHMSegment(mem_size, "dolphin-emu");
+  const bool export_memory = Config::Get(Config::MAIN_EXPORT_SHARED_MEMORY);
+  m_arena.GrabSHMSegment(mem_size, "dolphin-emu", export_memory);
 
   m_physical_page_mappings.fill(nullptr);
 
@@ -176,6 +181,9 @@ void MemoryManager::Init()
 
   Clear();
 
+  if (export_memory)
+    InitSharedMemoryExport();
+
   INFO_LOG_FMT(MEMMAP, "Memory system initialized. RAM at {}", fmt::ptr(m_ram));
   m_is_initialized = true;
 }
@@ -333,6 +341,42 @@ void MemoryManager::UpdateDBATMappings(const PowerPC::BatTable& dbat_table)
   }
 }
 
+void MemoryManager::UpdatePhysicalMemCheckProtection(const MemChecks& mem_checks)
+{
+  if (!m_is_fastmem_arena_initialized)
+    return;
+
+  for (const u32 page : m_memcheck_protected_pages)
+    m_arena.ChangeMappingAccess(m_physical_base + page, m_page_size, true, true);
+  m_memcheck_protected_pages.clear();
+
+  if (!mem_checks.HasAny())
+    return;
+
+  // The value is whether reads have to fault too, or only writes.
+  std::map<u32, bool> pages;
+  for (const TMemCheck& mem_check : mem_checks.GetMemChecks())
+  {
+    for (const PhysicalMemoryRegion& region : m_physical_regions)
+    {
+      if (!region.active)
+        continue;
+
+      const u64 start = std::max<u64>(mem_check.start_address, region.physical_address);
+      const u64 end = std::min<u64>(u64{mem_check.end_address} + 1,
+                                    u64{region.physical_address} + region.size);
+      for (u64 page = start & ~u64{m_page_size - 1}; page < end; page += m_page_size)
+        pages[static_cast<u32>(page)] |= mem_check.is_break_on_read;
+    }
+  }
+
+  for (const auto& [page, watch_reads] : pages)
+  {
+    if (m_arena.ChangeMappingAccess(m_physical_base + page, m_page_size, !watch_reads, false))
+      m_memcheck_protected_pages.insert(page);
+  }
+}
+
 void MemoryManager::AddPageTableMapping(u32 logical_address, u32 translated_address, bool writeable)
 {
   if (!m_is_fastmem_arena_initialized)
@@ -541,6 +585,10 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
+  const bool writes_memory = p.IsReadMode();
+  if (writes_memory)
+    BeginSharedMemoryExportWrite();
+
   p.DoArray(m_ram, current_ram_size);
   p.DoArray(m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
@@ -550,12 +598,87 @@ void MemoryManager::DoState(PointerWrap& p)
   if (current_have_exram)
     p.DoArray(m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
+
+  if (writes_memory)
+    EndSharedMemoryExportWrite();
+}
+
+void MemoryManager::InitSharedMemoryExport()
+{
+  const std::string& memory_segment_name = m_arena.GetExportedSHMSegmentName();
+  if (memory_segment_name.empty())
+    return;
+
+  m_export_arena.GrabSHMSegment(sizeof(SharedMemoryExportHeader), "dolphin-emu-export", true);
+  void* view = m_export_arena.CreateView(0, sizeof(SharedMemoryExportHeader));
+  if (!view)
+  {
+    ERROR_LOG_FMT(MEMMAP, "Failed to create the shared memory export header");
+    m_export_arena.ReleaseSHMSegment();
+    return;
+  }
+
+  m_export_header = new (view) SharedMemoryExportHeader();
+  m_export_header->mem1_offset = m_physical_regions[0].shm_position;
+  m_export_header->mem1_size = GetRamSizeReal();
+  if (m_physical_regions[3].active)
+  {
+    m_export_header->mem2_offset = m_physical_regions[3].shm_position;
+    m_export_header->mem2_size = GetExRamSizeReal();
+  }
+  memory_segment_name.copy(m_export_header->memory_segment_name,
+                           sizeof(m_export_header->memory_segment_name) - 1);
+
+  NOTICE_LOG_FMT(MEMMAP, "Exported emulated memory as {} (header: {})", memory_segment_name,
+                 m_export_arena.GetExportedSHMSegmentName());
+}
+
+void MemoryManager::ShutdownSharedMemoryExport()
+{
+  if (!m_export_header)
+    return;
+
+  m_export_header->~SharedMemoryExportHeader();
+  m_export_arena.ReleaseView(m_export_header, sizeof(SharedMemoryExportHeader));
+  m_export_arena.ReleaseSHMSegment();
+  m_export_header = nullptr;
+}
+
+void MemoryManager::BeginSharedMemoryExportWrite()
+{
+  if (!m_export_header)
+    return;
+
+  // Readers that see an odd sequence number know that a frame is ending or a state is being
+  // loaded.
+  m_export_header->sequence.fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void MemoryManager::EndSharedMemoryExportWrite()
+{
+  if (!m_export_header)
+    return;
+
+  m_export_header->sequence.fetch_add(1, std::memory_order_release);
+}
+
+void MemoryManager::AdvanceSharedMemoryExportFrame()
+{
+  if (!m_export_header)
+    return;
+
+  BeginSharedMemoryExportWrite();
+  m_export_header->frame.fetch_add(1, std::memory_order_relaxed);
+  EndSharedMemoryExportWrite();
 }
 
 void MemoryManager::Shutdown()
 {
   ShutdownFastmemArena();
 
+  ShutdownSharedMemoryExport();
+
   m_is_initialized = false;
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
@@ -596,6 +719,8 @@ void MemoryManager::ShutdownFastmemArena()
   }
   m_page_table_mapped_entries.clear();
 
+  m_memcheck_protected_pages.clear();
+
   m_arena.ReleaseMemoryRegion();
 
   m_large_readable_pages.clear();
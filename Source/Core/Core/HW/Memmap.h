@@ -18,6 +18,7 @@
 #include "Core/PowerPC/MMU.h"
 
 // Global declarations
+class MemChecks;
 class PointerWrap;
 namespace Core
 {
@@ -30,6 +31,7 @@ class Mapping;
 
 namespace Memory
 {
+struct SharedMemoryExportHeader;
 constexpr u32 MEM1_BASE_ADDR = 0x80000000U;
 constexpr u32 MEM2_BASE_ADDR = 0x90000000U;
 constexpr u32 MEM1_SIZE_RETAIL = 0x01800000U;
@@ -106,11 +108,20 @@ public:
   void ShutdownFastmemArena();
   void DoState(PointerWrap& p);
 
+  // Advances the frame counter of the shared memory export, if enabled (see SharedMemoryExport.h).
+  // Called by the CPU thread at the end of every frame.
+  void AdvanceSharedMemoryExportFrame();
+
   void UpdateDBATMappings(const PowerPC::BatTable& dbat_table);
   void AddPageTableMapping(u32 logical_address, u32 translated_address, bool writeable);
   void RemovePageTableMappings(const std::set<u32>& mappings);
   void RemoveAllPageTableMappings();
 
+  // Removes access to the pages of the physical fastmem view that contain memchecks. Accesses to
+  // those pages fault and get backpatched into slow accesses, which check the memchecks, while
+  // accesses to other pages stay fast.
+  void UpdatePhysicalMemCheckProtection(const MemChecks& mem_checks);
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -227,6 +238,10 @@ private:
   // The MemArena class
   Common::MemArena m_arena;
 
+  // Only used if memory is exported to other processes.
+  Common::MemArena m_export_arena;
+  SharedMemoryExportHeader* m_export_header = nullptr;
+
   const u32 m_page_size;
   const u32 m_guest_pages_per_host_page;
   const HostPageType m_host_page_type;
@@ -275,6 +290,9 @@ private:
   std::map<u32, LogicalMemoryView> m_dbat_mapped_entries;
   std::map<u32, LogicalMemoryView> m_page_table_mapped_entries;
 
+  // Host pages of the physical fastmem view (by physical address) protected because of memchecks.
+  std::set<u32> m_memcheck_protected_pages;
+
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
@@ -297,5 +315,12 @@ private:
   void RemoveLargePageTableMapping(u32 logical_address);
   void RemoveLargePageTableMapping(u32 logical_address, std::map<u32, std::vector<u32>>& map);
   void RemoveHostPageTableMapping(u32 logical_address);
+
+  void InitSharedMemoryExport();
+  void ShutdownSharedMemoryExport();
+  // Make the shared memory export's sequence odd and even again around a frame end or a bulk
+  // write to memory. Writes by the emulated CPU aren't bracketed.
+  void BeginSharedMemoryExportWrite();
+  void EndSharedMemoryExportWrite();
 };
 }  // namespace Memory
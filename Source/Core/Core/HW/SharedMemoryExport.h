@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+
+#include "Common/CommonTypes.h"
+
+namespace Memory
+{
+// When Core.ExportSharedMemory is enabled, other processes of the same user can map emulated
+// memory directly, for tools that need to observe game state without copies or per-address
+// requests.
+//
+// The export consists of two shared memory segments:
+// - "dolphin-emu-export.<pid>" ("/dolphin-emu-export.<pid>" for shm_open) holds this header.
+// - The segment named in memory_segment_name holds emulated memory. It is the segment that backs
+//   Dolphin's own views of memory. Other processes can only open both segments for reading,
+//   although on Unix, the user could still change the permissions of the segments.
+// Exporting is not supported on macOS and Android.
+//
+// sequence is a frame counter, not a lock. It increases by 2 at the end of every frame, and is odd
+// while Dolphin rewrites memory in bulk, which only happens when loading a savestate. The emulated
+// game itself writes to memory at any time while emulation runs, and those writes don't touch
+// sequence. To tell whether a read spanned the end of a frame or a state load:
+// 1. Load sequence (acquire). If it's odd, a state is being loaded, so try again.
+// 2. Read from emulated memory.
+// 3. Issue an acquire fence and load sequence again. If it has changed, start over.
+// Even then, the read may see the game halfway through updating a value. For a view that doesn't
+// change at all, pause emulation or use frame advance.
+struct SharedMemoryExportHeader
+{
+  static constexpr u32 MAGIC = 0x58454D44;  // "DMEX"
+  static constexpr u32 VERSION = 1;
+
+  u32 magic = MAGIC;
+  u32 version = VERSION;
+  // See above
+  std::atomic<u64> sequence = 0;
+  // The number of frames emulated since the memory segment was created
+  std::atomic<u64> frame = 0;
+  // Byte offsets and sizes of MEM1 and MEM2 within the memory segment. mem2_size is 0 on GameCube.
+  u32 mem1_offset = 0;
+  u32 mem1_size = 0;
+  u32 mem2_offset = 0;
+  u32 mem2_size = 0;
+  // Null-terminated
+  char memory_segment_name[64]{};
+};
+
+// Other processes access the atomics through their own mappings.
+static_assert(std::atomic<u64>::is_always_lock_free);
+}  // namespace Memory
@@ -87,6 +87,15 @@ auto GetMetadataFields(T& obj)
   return std::tie(obj.uid, obj.gid, obj.is_file, obj.modes, obj.attribute);
 }
 
+// Returns whether path is directory or something inside it.
+static bool IsSameOrChildPath(std::string_view path, std::string_view directory)
+{
+  if (directory == "/")
+    return true;
+  return path.starts_with(directory) &&
+         (path.size() == directory.size() || path[directory.size()] == '/');
+}
+
 // Convert the host directory entries into ones that can be exposed to the emulated system.
 static u64 FixupDirectoryEntries(File::FSTEntry* dir, bool is_root)
 {
@@ -305,11 +314,11 @@ void HostFileSystem::DoState(PointerWrap& p)
 
   if (!p.IsReadMode())
   {
-    DoStateWriteOrMeasure(p, "/tmp");
+    DoStateDirectory(p, m_tmp_state_cache);
     u8* const nand_size_ptr = p.ReserveU32();
     if (is_full_nand_in_state)
     {
-      DoStateWriteOrMeasure(p, "/");
+      DoStateDirectory(p, m_nand_state_cache);
       if (p.IsWriteMode())
       {
         const u32 size_of_nand = p.GetOffsetFromPreviousPosition(nand_size_ptr) - sizeof(u32);
@@ -320,11 +329,11 @@ void HostFileSystem::DoState(PointerWrap& p)
   else  // case where we're in read mode.
   {
     u32 size_of_nand = 0;
-    DoStateRead(p, "/tmp");
+    DoStateDirectory(p, m_tmp_state_cache);
     if (is_full_nand_in_state && is_full_nand_wanted)
     {
       p.Do(size_of_nand);
-      DoStateRead(p, "/");
+      DoStateDirectory(p, m_nand_state_cache);
     }
     else
     {
@@ -344,6 +353,112 @@ void HostFileSystem::DoState(PointerWrap& p)
   }
 }
 
+void HostFileSystem::DoStateDirectory(PointerWrap& p, DirectoryStateCache& cache)
+{
+  if (p.IsReadMode())
+  {
+    // Nothing to do if the directory hasn't changed since this state was made, which is the
+    // common case when rewinding.
+    if (cache.valid && p.SkipIfEqual(cache.data))
+      return;
+
+    DoStateRead(p, cache.wii_path);
+    return;
+  }
+
+  if (!cache.valid)
+  {
+    u8* ptr = nullptr;
+    PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+    DoStateWriteOrMeasure(p_measure, cache.wii_path);
+    const size_t size = reinterpret_cast<size_t>(ptr);
+
+    cache.data.resize(size);
+    ptr = cache.data.data();
+    PointerWrap p_write(&ptr, size, PointerWrap::Mode::Write);
+    DoStateWriteOrMeasure(p_write, cache.wii_path);
+    if (!p_write.IsWriteMode())
+    {
+      // Shouldn't happen, but don't store a truncated cache if it does.
+      DoStateWriteOrMeasure(p, cache.wii_path);
+      return;
+    }
+    cache.valid = true;
+  }
+
+  p.DoArray(cache.data.data(), static_cast<u32>(cache.data.size()));
+}
+
+void HostFileSystem::InvalidateCaches(const std::string& wii_path)
+{
+  // A directory is affected if the modified path is inside it, or if it is inside the modified
+  // path (e.g. when a parent directory is deleted or renamed).
+  const auto is_affected = [&wii_path](const std::string& directory) {
+    return IsSameOrChildPath(wii_path, directory) || IsSameOrChildPath(directory, wii_path);
+  };
+
+  for (DirectoryStateCache* cache : {&m_tmp_state_cache, &m_nand_state_cache})
+  {
+    if (cache->valid && is_affected(cache->wii_path))
+    {
+      cache->valid = false;
+      cache->data = {};
+    }
+  }
+
+  // The stats of the directories containing wii_path are kept up to date by UpdateDirectoryStats.
+  std::erase_if(m_directory_stats_cache,
+                [&](const auto& entry) { return IsSameOrChildPath(entry.first, wii_path); });
+}
+
+void HostFileSystem::UpdateDirectoryStats(const std::string& wii_path, bool is_file,
+                                          const ExtendedDirectoryStats& old_usage,
+                                          const ExtendedDirectoryStats& new_usage)
+{
+  if (m_directory_stats_cache.empty())
+    return;
+
+  // Files in the root directory are hidden from the emulated system.
+  if (is_file && wii_path.rfind('/') == 0)
+    return;
+
+  // The stats of a directory only cover its host directory, so changes inside a redirect don't
+  // count towards the directories outside of it.
+  std::string_view boundary = "/";
+  for (const auto& redirect : m_nand_redirects)
+  {
+    if (IsSameOrChildPath(wii_path, redirect.source_path))
+      boundary = redirect.source_path;
+  }
+
+  // Unsigned wraparound turns these into the signed differences.
+  const u64 clusters = new_usage.used_clusters - old_usage.used_clusters;
+  const u64 inodes = new_usage.used_inodes - old_usage.used_inodes;
+
+  std::string_view directory = wii_path;
+  while (directory != boundary)
+  {
+    directory = directory.substr(0, std::max<size_t>(directory.rfind('/'), 1));
+    const auto it = m_directory_stats_cache.find(std::string(directory));
+    if (it == m_directory_stats_cache.end())
+      continue;
+    it->second.used_clusters += clusters;
+    it->second.used_inodes += inodes;
+  }
+}
+
+ExtendedDirectoryStats HostFileSystem::GetUsage(const std::string& wii_path, bool is_file)
+{
+  if (is_file)
+    return GetFileUsage(File::GetSize(BuildFilename(wii_path).host_path));
+  return GetExtendedDirectoryStats(wii_path).value_or(ExtendedDirectoryStats{});
+}
+
+ExtendedDirectoryStats HostFileSystem::GetFileUsage(u64 size)
+{
+  return {Common::AlignUp(size, CLUSTER_SIZE) / CLUSTER_SIZE, 1};
+}
+
 ResultCode HostFileSystem::Format(Uid uid)
 {
   if (uid != 0)
@@ -351,6 +466,7 @@ ResultCode HostFileSystem::Format(Uid uid)
   if (m_root_path.empty())
     return ResultCode::AccessDenied;
   const std::string root = BuildFilename("/").host_path;
+  InvalidateCaches("/");
   if (!File::DeleteDirRecursively(root) || !File::CreateDir(root))
     return ResultCode::UnknownError;
   ResetFst();
@@ -384,12 +500,14 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   if (File::Exists(host_path))
     return ResultCode::AlreadyExists;
 
+  InvalidateCaches(path);
   const bool ok = is_file ? File::CreateEmptyFile(host_path) : File::CreateDir(host_path);
   if (!ok)
   {
     ERROR_LOG_FMT(IOS_FS, "Failed to create file or directory: {}", host_path);
     return ResultCode::UnknownError;
   }
+  UpdateDirectoryStats(path, is_file, {}, GetFileUsage(0));
 
   FstEntry* child = GetFstEntryForPath(path);
   *child = {};
@@ -447,12 +565,18 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
   if (!File::Exists(host_path))
     return ResultCode::NotFound;
 
-  if (File::IsFile(host_path) && !IsFileOpened(path))
+  const bool is_file = File::IsFile(host_path);
+  if (is_file ? IsFileOpened(path) : !File::IsDirectory(host_path) || IsDirectoryInUse(path))
+    return ResultCode::InUse;
+
+  const ExtendedDirectoryStats usage =
+      m_directory_stats_cache.empty() ? ExtendedDirectoryStats{} : GetUsage(path, is_file);
+  InvalidateCaches(path);
+  if (is_file)
     File::Delete(host_path);
-  else if (File::IsDirectory(host_path) && !IsDirectoryInUse(path))
-    File::DeleteDirRecursively(host_path);
   else
-    return ResultCode::InUse;
+    File::DeleteDirRecursively(host_path);
+  UpdateDirectoryStats(path, is_file, usage, {});
 
   const auto it = std::ranges::find(parent->children, split_path.file_name, &FstEntry::name);
   if (it != parent->children.end())
@@ -501,21 +625,37 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
   const std::string& host_old_path = host_old_info.host_path;
   const std::string& host_new_path = host_new_info.host_path;
 
+  const bool is_file = File::IsFile(host_old_path);
+  const bool replaces_existing = File::Exists(host_new_path);
+  if (replaces_existing && is_file != File::IsFile(host_new_path))
+    return ResultCode::Invalid;
+
+  ExtendedDirectoryStats moved_usage{};
+  ExtendedDirectoryStats replaced_usage{};
+  if (!m_directory_stats_cache.empty())
+  {
+    moved_usage = GetUsage(old_path, is_file);
+    if (replaces_existing)
+      replaced_usage = GetUsage(new_path, is_file);
+  }
+
+  InvalidateCaches(old_path);
+  InvalidateCaches(new_path);
+
   // If there is already something of the same type at the new path, delete it.
-  if (File::Exists(host_new_path))
+  if (replaces_existing)
   {
-    const bool old_is_file = File::IsFile(host_old_path);
-    const bool new_is_file = File::IsFile(host_new_path);
-    if (old_is_file && new_is_file)
+    if (is_file)
       File::Delete(host_new_path);
-    else if (!old_is_file && !new_is_file)
-      File::DeleteDirRecursively(host_new_path);
     else
-      return ResultCode::Invalid;
+      File::DeleteDirRecursively(host_new_path);
   }
 
   if (!File::Rename(host_old_path, host_new_path))
   {
+    // The replaced entry may be gone already, so the cached stats can't be updated reliably.
+    m_directory_stats_cache.clear();
+
     if (host_old_info.is_redirect || host_new_info.is_redirect)
     {
       // If either path is a redirect, the source and target may be on a different partition or
@@ -539,6 +679,9 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
     }
   }
 
+  UpdateDirectoryStats(old_path, is_file, moved_usage, {});
+  UpdateDirectoryStats(new_path, is_file, replaced_usage, moved_usage);
+
   FstEntry* new_entry = GetFstEntryForPath(new_path);
   new_entry->name = split_new_path.file_name;
 
@@ -667,6 +810,7 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
     entry->data.uid = uid;
     entry->data.attribute = attr;
     entry->data.modes = modes;
+    InvalidateCaches(path);
     SaveFst();
   }
 
@@ -722,6 +866,9 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
   if (!IsValidPath(wii_path))
     return std::unexpected{ResultCode::Invalid};
 
+  if (const auto it = m_directory_stats_cache.find(wii_path); it != m_directory_stats_cache.end())
+    return it->second;
+
   ExtendedDirectoryStats stats{};
   std::string path(BuildFilename(wii_path).host_path);
   File::FileInfo info(path);
@@ -742,11 +889,13 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
   {
     return std::unexpected{ResultCode::Invalid};
   }
+  m_directory_stats_cache.emplace(wii_path, stats);
   return stats;
 }
 
 void HostFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
 {
   m_nand_redirects = std::move(nand_redirects);
+  InvalidateCaches("/");
 }
 }  // namespace IOS::HLE::FS
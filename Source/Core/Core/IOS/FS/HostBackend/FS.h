@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -91,6 +92,28 @@ private:
     bool is_redirect;
   };
   HostFilename BuildFilename(const std::string& wii_path) const;
+
+  /// Serialized contents of a directory, as written by DoStateWriteOrMeasure. Savestates reuse it
+  /// until something inside the directory is modified, instead of walking the host directory and
+  /// reading every file again.
+  struct DirectoryStateCache
+  {
+    std::string wii_path;
+    std::vector<u8> data;
+    bool valid = false;
+  };
+  void DoStateDirectory(PointerWrap& p, DirectoryStateCache& cache);
+  /// Invalidates the state caches affected by a modification of wii_path, and the directory stats
+  /// of wii_path and everything inside it. Must be called whenever a file or directory is modified.
+  void InvalidateCaches(const std::string& wii_path);
+  /// Applies a change in the usage of wii_path, which is a file or a directory with its contents,
+  /// to the cached stats of the directories containing it.
+  void UpdateDirectoryStats(const std::string& wii_path, bool is_file,
+                            const ExtendedDirectoryStats& old_usage,
+                            const ExtendedDirectoryStats& new_usage);
+  /// Returns the usage of wii_path, including the contents of a directory.
+  ExtendedDirectoryStats GetUsage(const std::string& wii_path, bool is_file);
+  static ExtendedDirectoryStats GetFileUsage(u64 size);
   std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path);
 
   ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
@@ -122,6 +145,13 @@ private:
 
   FstEntry m_redirect_fst{};
   std::vector<NandRedirect> m_nand_redirects;
+
+  DirectoryStateCache m_tmp_state_cache{"/tmp"};
+  DirectoryStateCache m_nand_state_cache{"/"};
+
+  /// Usage of the directories that were queried, so that repeated stats requests don't have to
+  /// scan the host directory tree again. Kept up to date by UpdateDirectoryStats.
+  std::unordered_map<std::string, ExtendedDirectoryStats> m_directory_stats_cache;
 };
 
 }  // namespace IOS::HLE::FS
@@ -168,10 +168,20 @@ Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
   if ((u8(handle->mode) & u8(Mode::Write)) == 0)
     return std::unexpected{ResultCode::AccessDenied};
 
+  InvalidateCaches(handle->wii_path);
+  const u64 old_size = m_directory_stats_cache.empty() ? 0 : handle->host_file->GetSize();
+
   // File might be opened twice, need to seek before we read
   handle->host_file->Seek(handle->file_offset, File::SeekOrigin::Begin);
   if (!handle->host_file->WriteBytes(ptr, count))
+  {
+    // Part of the data may have been written.
+    m_directory_stats_cache.clear();
     return std::unexpected{ResultCode::AccessDenied};
+  }
+
+  const u64 new_size = std::max<u64>(old_size, u64{handle->file_offset} + count);
+  UpdateDirectoryStats(handle->wii_path, true, GetFileUsage(old_size), GetFileUsage(new_size));
 
   handle->file_offset += count;
   return count;
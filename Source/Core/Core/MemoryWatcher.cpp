@@ -3,14 +3,19 @@
 
 #include "Core/MemoryWatcher.h"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <unistd.h>
+#include <utility>
 
 #include "Common/FileUtil.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 MemoryWatcher::MemoryWatcher()
 {
@@ -38,23 +43,27 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   if (!locations)
     return false;
 
+  // Address as stored in the file -> list of offsets to follow
+  std::map<std::string, std::vector<u32>> addresses;
   std::string line;
   while (std::getline(locations, line))
-    ParseLine(line);
+    addresses[line] = ParseLine(line);
 
-  return !m_values.empty();
+  for (auto& [address, offsets] : addresses)
+    m_watched_addresses.push_back({.line = address, .offsets = std::move(offsets)});
+
+  return !m_watched_addresses.empty();
 }
 
-void MemoryWatcher::ParseLine(const std::string& line)
+std::vector<u32> MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
-
+  std::vector<u32> result;
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    result.push_back(offset);
+  return result;
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -66,34 +75,105 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line)
+u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const WatchedAddress& watched,
+                                std::vector<u32>* pages)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (u32 offset : watched.offsets)
   {
-    value = PowerPC::MMU::HostRead<u32>(guard, value + offset);
+    const u32 address = value + offset;
+    constexpr u32 page_mask = ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+    pages->push_back(address & page_mask);
+    pages->push_back((address + static_cast<u32>(sizeof(u32)) - 1) & page_mask);
+
+    value = PowerPC::MMU::HostRead<u32>(guard, address);
     if (!PowerPC::MMU::HostIsRAMAddress(guard, value))
       break;
   }
   return value;
 }
 
+void MemoryWatcher::MarkChangedPages(const Core::CPUThreadGuard& guard)
+{
+  for (auto& [page_address, page] : m_watched_pages)
+  {
+    const u8* host_page = PowerPC::MMU::HostGetPagePointer(guard, page_address);
+    const bool changed = !host_page || host_page != page.host_page ||
+                         std::memcmp(host_page, page.snapshot.get(), PowerPC::HW_PAGE_SIZE) != 0;
+    if (!changed)
+      continue;
+
+    for (const size_t index : page.watchers)
+      m_watched_addresses[index].dirty = true;
+
+    page.host_page = host_page;
+    if (host_page)
+      std::memcpy(page.snapshot.get(), host_page, PowerPC::HW_PAGE_SIZE);
+  }
+}
+
+void MemoryWatcher::UpdateWatchedPages(const Core::CPUThreadGuard& guard, size_t index,
+                                       std::vector<u32> new_pages)
+{
+  std::ranges::sort(new_pages);
+  const auto [first, last] = std::ranges::unique(new_pages);
+  new_pages.erase(first, last);
+
+  std::vector<u32>& old_pages = m_watched_addresses[index].pages;
+  for (const u32 page_address : old_pages)
+  {
+    if (std::ranges::binary_search(new_pages, page_address))
+      continue;
+
+    auto it = m_watched_pages.find(page_address);
+    std::erase(it->second.watchers, index);
+    if (it->second.watchers.empty())
+      m_watched_pages.erase(it);
+  }
+
+  for (const u32 page_address : new_pages)
+  {
+    if (std::ranges::binary_search(old_pages, page_address))
+      continue;
+
+    auto [it, inserted] = m_watched_pages.try_emplace(page_address);
+    WatchedPage& page = it->second;
+    page.watchers.push_back(index);
+    if (inserted)
+    {
+      page.snapshot = std::make_unique<u8[]>(PowerPC::HW_PAGE_SIZE);
+      page.host_page = PowerPC::MMU::HostGetPagePointer(guard, page_address);
+      if (page.host_page)
+        std::memcpy(page.snapshot.get(), page.host_page, PowerPC::HW_PAGE_SIZE);
+    }
+  }
+
+  old_pages = std::move(new_pages);
+}
+
 std::string MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
 {
   std::ostringstream message_stream;
   message_stream << std::hex;
 
-  for (auto& entry : m_values)
+  MarkChangedPages(guard);
+
+  for (size_t i = 0; i < m_watched_addresses.size(); ++i)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
+    if (!m_watched_addresses[i].dirty)
+      continue;
+
+    std::vector<u32> pages;
+    const u32 new_value = ChasePointer(guard, m_watched_addresses[i], &pages);
+    UpdateWatchedPages(guard, i, std::move(pages));
 
-    u32 new_value = ChasePointer(guard, address);
-    if (new_value != current_value)
+    WatchedAddress& watched = m_watched_addresses[i];
+    watched.dirty = false;
+    if (new_value != watched.value)
     {
       // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      watched.value = new_value;
+      message_stream << watched.line << '\n' << new_value << '\n';
     }
   }
 
@@ -6,6 +6,7 @@
 #include "Common/CommonTypes.h"
 
 #include <map>
+#include <memory>
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -24,6 +25,10 @@ class CPUThreadGuard;
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
 // The output to the socket is two lines. The first is the address from the
 // input file, and the second is the new value in hex.
+//
+// To keep the per-frame cost low with many addresses, the pages that each address (and each
+// pointer along its chain) was read from are compared against a copy taken on the previous step,
+// and only the addresses on pages that have changed since then are read again.
 class MemoryWatcher final
 {
 public:
@@ -35,8 +40,34 @@ private:
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
 
-  void ParseLine(const std::string& line);
-  u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line);
+  struct WatchedAddress
+  {
+    // Address as stored in the file
+    std::string line;
+    // List of offsets to follow
+    std::vector<u32> offsets;
+    u32 value = 0;
+    // Pages (by effective address) read the last time the value was updated
+    std::vector<u32> pages;
+    bool dirty = true;
+  };
+
+  struct WatchedPage
+  {
+    // Where the page was in host memory on the last step, or nullptr if it isn't in RAM
+    const u8* host_page = nullptr;
+    // Contents of the page on the last step
+    std::unique_ptr<u8[]> snapshot;
+    // Indices into m_watched_addresses
+    std::vector<size_t> watchers;
+  };
+
+  static std::vector<u32> ParseLine(const std::string& line);
+  u32 ChasePointer(const Core::CPUThreadGuard& guard, const WatchedAddress& watched,
+                   std::vector<u32>* pages);
+  void MarkChangedPages(const Core::CPUThreadGuard& guard);
+  void UpdateWatchedPages(const Core::CPUThreadGuard& guard, size_t index,
+                          std::vector<u32> new_pages);
   std::string ComposeMessages(const Core::CPUThreadGuard& guard);
 
   bool m_running = false;
@@ -44,8 +75,8 @@ private:
   int m_fd;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  // Sorted by the address as stored in the file
+  std::vector<WatchedAddress> m_watched_addresses;
+  // Effective address -> page state
+  std::map<u32, WatchedPage> m_watched_pages;
 };
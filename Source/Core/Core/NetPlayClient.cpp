@@ -20,12 +20,15 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include "AudioCommon/Mixer.h"
+#include "AudioCommon/SoundStream.h"
 #include "Common/Assert.h"
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/ENet.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
@@ -41,7 +44,9 @@
 #include "Core/Config/NetplaySettings.h"
 #include "Core/Config/SessionSettings.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/GeckoCode.h"
+#include "Core/HW/CPU.h"
 #include "Core/HW/EXI/EXI.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
 #ifdef HAS_LIBMGBA
@@ -64,6 +69,7 @@
 #include "Core/IOS/Uids.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayCommon.h"
+#include "Core/NetPlayGameDigest.h"
 #include "Core/SyncIdentifier.h"
 #include "Core/System.h"
 #include "DiscIO/Blob.h"
@@ -71,6 +77,7 @@
 #include "InputCommon/GCAdapter.h"
 #include "UICommon/GameFile.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/Present.h"
 
 namespace NetPlay
 {
@@ -683,7 +690,12 @@ void NetPlayClient::OnPadData(sf::Packet& packet)
           pad.substickY >> pad.triggerLeft >> pad.triggerRight >> pad.isConnected;
     }
 
-    if (static_cast<size_t>(map) < m_pad_buffer.size())
+    if (m_rollback.IsActive())
+    {
+      m_rollback.AddRemoteInput(map, pad);
+      m_gc_pad_event.Set();
+    }
+    else if (static_cast<size_t>(map) < m_pad_buffer.size())
     {
       m_pad_buffer.at(map).Push(pad);
       m_gc_pad_event.Set();
@@ -928,6 +940,7 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
     packet >> m_net_settings.sync_codes;
 
     packet >> m_net_settings.golf_mode;
+    packet >> m_net_settings.rollback;
     packet >> m_net_settings.use_fma;
     packet >> m_net_settings.hide_remote_gbas;
 
@@ -935,6 +948,8 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
       packet >> m_net_settings.sram[i];
 
     m_net_settings.is_hosting = m_local_player->IsHost();
+
+    StartRollbackSession();
   }
 
   m_dialog->OnMsgStartGame();
@@ -1021,10 +1036,26 @@ void NetPlayClient::OnSyncSaveData(sf::Packet& packet)
     OnSyncSaveDataRaw(packet);
     break;
 
+  case SyncSaveDataID::RawDataHashes:
+    OnSyncSaveDataRawHashes(packet);
+    break;
+
+  case SyncSaveDataID::RawDataBlocks:
+    OnSyncSaveDataRawBlocks(packet);
+    break;
+
   case SyncSaveDataID::GCIData:
     OnSyncSaveDataGCI(packet);
     break;
 
+  case SyncSaveDataID::GCIDataHashes:
+    OnSyncSaveDataGCIHashes(packet);
+    break;
+
+  case SyncSaveDataID::GCIDataBlocks:
+    OnSyncSaveDataGCIBlocks(packet);
+    break;
+
   case SyncSaveDataID::WiiData:
     OnSyncSaveDataWii(packet);
     break;
@@ -1052,6 +1083,28 @@ void NetPlayClient::OnSyncSaveDataNotify(sf::Packet& packet)
     m_dialog->AppendChat(Common::GetStringT("Synchronizing save data..."));
 }
 
+static std::optional<std::string> GetNetPlayRawMemcardPath(bool is_slot_a,
+                                                           const std::string& region,
+                                                           int size_override)
+{
+  // This check is mainly intended to filter out characters which have special meanings in paths
+  if (region != JAP_DIR && region != USA_DIR && region != EUR_DIR)
+  {
+    WARN_LOG_FMT(NETPLAY, "Received invalid raw memory card region.");
+    return std::nullopt;
+  }
+
+  std::string size_suffix;
+  if (size_override >= 0 && size_override <= 4)
+  {
+    size_suffix = fmt::format(
+        ".{}", Memcard::MbitToFreeBlocks(Memcard::MBIT_SIZE_MEMORY_CARD_59 << size_override));
+  }
+
+  return File::GetUserPath(D_GCUSER_IDX) + GC_MEMCARD_NETPLAY + (is_slot_a ? "A." : "B.") +
+         region + size_suffix + ".raw";
+}
+
 void NetPlayClient::OnSyncSaveDataRaw(sf::Packet& packet)
 {
   bool is_slot_a;
@@ -1062,23 +1115,14 @@ void NetPlayClient::OnSyncSaveDataRaw(sf::Packet& packet)
   INFO_LOG_FMT(NETPLAY, "Received raw memcard data for slot {}: region {}, size override {}.",
                is_slot_a ? 'A' : 'B', region, size_override);
 
-  // This check is mainly intended to filter out characters which have special meanings in paths
-  if (region != JAP_DIR && region != USA_DIR && region != EUR_DIR)
+  const auto maybe_path = GetNetPlayRawMemcardPath(is_slot_a, region, size_override);
+  if (!maybe_path)
   {
-    WARN_LOG_FMT(NETPLAY, "Received invalid raw memory card region.");
     SyncSaveDataResponse(false);
     return;
   }
 
-  std::string size_suffix;
-  if (size_override >= 0 && size_override <= 4)
-  {
-    size_suffix = fmt::format(
-        ".{}", Memcard::MbitToFreeBlocks(Memcard::MBIT_SIZE_MEMORY_CARD_59 << size_override));
-  }
-
-  const std::string path = File::GetUserPath(D_GCUSER_IDX) + GC_MEMCARD_NETPLAY +
-                           (is_slot_a ? "A." : "B.") + region + size_suffix + ".raw";
+  const std::string& path = *maybe_path;
   if (File::Exists(path) && !File::Delete(path))
   {
     PanicAlertFmtT("Failed to delete NetPlay memory card. Verify your write permissions.");
@@ -1090,22 +1134,137 @@ void NetPlayClient::OnSyncSaveDataRaw(sf::Packet& packet)
   SyncSaveDataResponse(success);
 }
 
+void NetPlayClient::OnSyncSaveDataRawHashes(sf::Packet& packet)
+{
+  bool is_slot_a;
+  std::string region;
+  int size_override;
+  packet >> is_slot_a >> region >> size_override;
+  const u64 size = Common::PacketReadU64(packet);
+
+  INFO_LOG_FMT(NETPLAY,
+               "Received raw memcard hashes for slot {}: region {}, size override {}, size {}.",
+               is_slot_a ? 'A' : 'B', region, size_override, size);
+
+  const auto path = GetNetPlayRawMemcardPath(is_slot_a, region, size_override);
+  // The largest supported card is 128 Mbit.
+  constexpr u64 max_size = u64{Memcard::MBIT_SIZE_MEMORY_CARD_2043} * 1024 * 1024 / 8;
+  if (!path || size > max_size)
+  {
+    SyncSaveDataResponse(false);
+    return;
+  }
+
+  std::vector<u64> hashes((size + SAVE_SYNC_BLOCK_SIZE - 1) / SAVE_SYNC_BLOCK_SIZE);
+  for (u64& hash : hashes)
+    hash = Common::PacketReadU64(packet);
+
+  // Start from the card that was received in a previous session, if there is one.
+  std::string local_data;
+  if (File::Exists(*path))
+    File::ReadFileToString(*path, local_data);
+
+  RawMemcardSync& sync = m_raw_memcard_sync[is_slot_a ? 0 : 1];
+  sync.path = *path;
+  sync.data.assign(local_data.begin(), local_data.end());
+  sync.data.resize(size);
+
+  const std::vector<u32> changed_blocks = FindChangedBlocks(sync.data, hashes);
+  if (changed_blocks.empty())
+  {
+    INFO_LOG_FMT(NETPLAY, "Raw memcard {} is already up to date.", *path);
+    // The card still has to be truncated if it was larger.
+    bool success = true;
+    if (local_data.size() != size)
+    {
+      File::IOFile file(*path, "wb");
+      success = file.WriteBytes(sync.data.data(), sync.data.size());
+    }
+    sync = {};
+    SyncSaveDataResponse(success);
+    return;
+  }
+
+  INFO_LOG_FMT(NETPLAY, "Requesting {} of {} blocks of raw memcard {}.", changed_blocks.size(),
+               hashes.size(), *path);
+
+  sf::Packet request;
+  request << MessageID::SyncSaveData;
+  request << SyncSaveDataID::RawDataRequest;
+  request << is_slot_a << static_cast<u32>(changed_blocks.size());
+  for (const u32 index : changed_blocks)
+    request << index;
+  Send(request);
+}
+
+void NetPlayClient::OnSyncSaveDataRawBlocks(sf::Packet& packet)
+{
+  bool is_slot_a;
+  packet >> is_slot_a;
+
+  RawMemcardSync& sync = m_raw_memcard_sync[is_slot_a ? 0 : 1];
+  if (sync.path.empty() || !DecompressPacketIntoBlocks(packet, sync.data))
+  {
+    sync = {};
+    SyncSaveDataResponse(false);
+    return;
+  }
+
+  INFO_LOG_FMT(NETPLAY, "Received raw memcard blocks for slot {}.", is_slot_a ? 'A' : 'B');
+
+  File::IOFile file(sync.path, "wb");
+  const bool success = file.WriteBytes(sync.data.data(), sync.data.size());
+  sync = {};
+  SyncSaveDataResponse(success);
+}
+
+static std::string GetNetPlayGCIFolderPath(bool is_slot_a)
+{
+  return File::GetUserPath(D_GCUSER_IDX) + GC_MEMCARD_NETPLAY DIR_SEP +
+         fmt::format("Card {}", is_slot_a ? 'A' : 'B');
+}
+
+static bool ResetNetPlayGCIFolder(const std::string& path)
+{
+  if ((File::Exists(path) && !File::DeleteDirRecursively(path + DIR_SEP)) ||
+      !File::CreateFullPath(path + DIR_SEP))
+  {
+    PanicAlertFmtT("Failed to reset NetPlay GCI folder. Verify your write permissions.");
+    return false;
+  }
+  return true;
+}
+
+static bool
+WriteNetPlayGCIFolder(const std::string& path,
+                      const std::vector<std::pair<std::string, std::vector<u8>>>& files)
+{
+  if (!ResetNetPlayGCIFolder(path))
+    return false;
+
+  for (const auto& [file_name, data] : files)
+  {
+    File::IOFile file(path + DIR_SEP + file_name, "wb");
+    if (!file.WriteBytes(data.data(), data.size()))
+      return false;
+  }
+
+  return true;
+}
+
 void NetPlayClient::OnSyncSaveDataGCI(sf::Packet& packet)
 {
   bool is_slot_a;
   u8 file_count;
   packet >> is_slot_a >> file_count;
 
-  const std::string path = File::GetUserPath(D_GCUSER_IDX) + GC_MEMCARD_NETPLAY DIR_SEP +
-                           fmt::format("Card {}", is_slot_a ? 'A' : 'B');
+  const std::string path = GetNetPlayGCIFolderPath(is_slot_a);
 
   INFO_LOG_FMT(NETPLAY, "Received GCI memcard data for slot {}: {}, {} files.",
                is_slot_a ? 'A' : 'B', path, file_count);
 
-  if ((File::Exists(path) && !File::DeleteDirRecursively(path + DIR_SEP)) ||
-      !File::CreateFullPath(path + DIR_SEP))
+  if (!ResetNetPlayGCIFolder(path))
   {
-    PanicAlertFmtT("Failed to reset NetPlay GCI folder. Verify your write permissions.");
     SyncSaveDataResponse(false);
     return;
   }
@@ -1129,6 +1288,112 @@ void NetPlayClient::OnSyncSaveDataGCI(sf::Packet& packet)
   SyncSaveDataResponse(true);
 }
 
+void NetPlayClient::OnSyncSaveDataGCIHashes(sf::Packet& packet)
+{
+  bool is_slot_a;
+  u8 file_count;
+  packet >> is_slot_a >> file_count;
+
+  GCIFolderSync& sync = m_gci_folder_sync[is_slot_a ? 0 : 1];
+  sync = {};
+  sync.path = GetNetPlayGCIFolderPath(is_slot_a);
+
+  INFO_LOG_FMT(NETPLAY, "Received GCI memcard hashes for slot {}: {}, {} files.",
+               is_slot_a ? 'A' : 'B', sync.path, file_count);
+
+  sf::Packet request;
+  request << MessageID::SyncSaveData;
+  request << SyncSaveDataID::GCIDataRequest;
+  request << is_slot_a;
+  u8 requested_file_count = 0;
+  sf::Packet requested_blocks;
+
+  for (u8 i = 0; i < file_count; i++)
+  {
+    std::string file_name;
+    packet >> file_name;
+    const u64 size = Common::PacketReadU64(packet);
+
+    // A GCI file can't be larger than the largest supported card.
+    constexpr u64 max_size = u64{Memcard::MBIT_SIZE_MEMORY_CARD_2043} * 1024 * 1024 / 8;
+    if (!packet || !Common::IsFileNameSafe(file_name) || size > max_size)
+    {
+      WARN_LOG_FMT(NETPLAY, "Received invalid GCI hashes.");
+      sync = {};
+      SyncSaveDataResponse(false);
+      return;
+    }
+
+    std::vector<u64> hashes((size + SAVE_SYNC_BLOCK_SIZE - 1) / SAVE_SYNC_BLOCK_SIZE);
+    for (u64& hash : hashes)
+      hash = Common::PacketReadU64(packet);
+
+    // Start from the file of the same name that was received in a previous session.
+    std::string local_data;
+    const std::string file_path = sync.path + DIR_SEP + file_name;
+    if (File::Exists(file_path))
+      File::ReadFileToString(file_path, local_data);
+
+    std::vector<u8> data(local_data.begin(), local_data.end());
+    data.resize(size);
+
+    const std::vector<u32> changed_blocks = FindChangedBlocks(data, hashes);
+    if (!changed_blocks.empty())
+    {
+      INFO_LOG_FMT(NETPLAY, "Requesting {} of {} blocks of GCI {}.", changed_blocks.size(),
+                   hashes.size(), file_name);
+      requested_blocks << i << static_cast<u32>(changed_blocks.size());
+      for (const u32 index : changed_blocks)
+        requested_blocks << index;
+      ++requested_file_count;
+    }
+
+    sync.files.emplace_back(std::move(file_name), std::move(data));
+  }
+
+  if (requested_file_count == 0)
+  {
+    INFO_LOG_FMT(NETPLAY, "GCI memcard {} is already up to date.", sync.path);
+    // Files of other saves or sessions still have to be removed.
+    const bool success = WriteNetPlayGCIFolder(sync.path, sync.files);
+    sync = {};
+    SyncSaveDataResponse(success);
+    return;
+  }
+
+  request << requested_file_count;
+  request.append(requested_blocks.getData(), requested_blocks.getDataSize());
+  Send(request);
+}
+
+void NetPlayClient::OnSyncSaveDataGCIBlocks(sf::Packet& packet)
+{
+  bool is_slot_a;
+  u8 file_count;
+  packet >> is_slot_a >> file_count;
+
+  GCIFolderSync& sync = m_gci_folder_sync[is_slot_a ? 0 : 1];
+  bool success = !sync.path.empty() && packet;
+  for (u8 i = 0; success && i < file_count; i++)
+  {
+    u8 file_index;
+    packet >> file_index;
+    success = packet && file_index < sync.files.size() &&
+              DecompressPacketIntoBlocks(packet, sync.files[file_index].second);
+  }
+
+  INFO_LOG_FMT(NETPLAY, "Received blocks of {} GCI files for slot {}.", file_count,
+               is_slot_a ? 'A' : 'B');
+
+  if (success)
+    success = WriteNetPlayGCIFolder(sync.path, sync.files);
+  else
+    WARN_LOG_FMT(NETPLAY, "Received invalid GCI blocks.");
+
+  sync = {};
+  SyncSaveDataResponse(success);
+}
+
 void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
 {
   const std::string path = File::GetUserPath(D_USER_IDX) + "Wii" GC_MEMCARD_NETPLAY DIR_SEP;
@@ -1500,10 +1765,54 @@ void NetPlayClient::OnGameDigestResult(sf::Packet& packet)
 {
   PlayerId pid;
   std::string result;
+  u32 region_count;
   packet >> pid;
   packet >> result;
+  packet >> region_count;
+
+  // The count comes from another player, so check it against what the packet can hold before
+  // allocating anything.
+  const size_t bytes_left = packet.getDataSize() - packet.getReadPosition();
+  if (!packet || region_count > MAX_GAME_DIGEST_REGIONS ||
+      region_count > bytes_left / Common::SHA1::DIGEST_LEN)
+  {
+    ERROR_LOG_FMT(NETPLAY, "Received an invalid game digest from player {}", pid);
+    return;
+  }
+
+  GameDigest remote_digest;
+  remote_digest.regions.resize(region_count);
+  for (Common::SHA1::Digest& region : remote_digest.regions)
+  {
+    for (u8& byte : region)
+      packet >> byte;
+  }
 
   m_dialog->SetGameDigestResult(pid, result);
+
+  if (pid == m_local_player->pid || result.empty())
+    return;
+
+  std::optional<size_t> different_region;
+  {
+    std::lock_guard lk(m_game_digest_mutex);
+    if (m_game_digest)
+      different_region = FindFirstDifferentRegion(*m_game_digest, remote_digest);
+  }
+
+  if (different_region)
+  {
+    std::string name;
+    {
+      std::lock_guard lkp(m_crit.players);
+      if (const auto it = m_players.find(pid); it != m_players.end())
+        name = it->second.name;
+    }
+
+    m_dialog->AppendChat(Common::FmtFormatT("{0}'s game differs from yours at offset {1:#x}.",
+                                            name,
+                                            *different_region * GAME_DIGEST_REGION_SIZE));
+  }
 }
 
 void NetPlayClient::OnGameDigestError(sf::Packet& packet)
@@ -1762,7 +2071,12 @@ bool NetPlayClient::StartGame(const std::string& path)
 
   m_first_pad_status_received.fill(false);
 
-  if (m_dialog->IsRecording())
+  // Resimulated frames would be recorded a second time.
+  if (m_dialog->IsRecording() && m_rollback.IsActive())
+  {
+    WARN_LOG_FMT(NETPLAY, "Input recording is not supported in the rollback network mode");
+  }
+  else if (m_dialog->IsRecording())
   {
     auto& movie = Core::System::GetInstance().GetMovie();
     if (movie.IsReadOnly())
@@ -1990,6 +2304,9 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     m_wait_on_input_event.Wait();
   }
 
+  if (m_rollback.IsActive())
+    return GetRollbackPads(pad_nb, batching, pad_status);
+
   if (IsFirstInGamePad(pad_nb) && batching)
   {
     sf::Packet packet;
@@ -2123,26 +2440,121 @@ bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entrie
   return true;
 }
 
-bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
+// called from ---CPU--- thread
+bool NetPlayClient::GetRollbackPads(const int pad_nb, const bool batching, GCPadStatus* pad_status)
 {
-  const int ingame_pad = LocalPadToInGamePad(local_pad);
-  bool data_added = false;
-  GCPadStatus pad_status;
-
-  if (m_net_settings.gba_config[ingame_pad].enabled)
+  // A frame begins on each VI poll of the first in-game pad. Those can't happen twice before the
+  // JIT checks the CPU state again, so every frame gets its own safe point. Polls from MMIO read
+  // the inputs of the current frame.
+  if (IsFirstInGamePad(pad_nb) && batching)
   {
-    pad_status = Pad::GetGBAStatus(local_pad);
+    if (m_rollback.BeginFrame())
+    {
+      sf::Packet packet;
+      packet << MessageID::PadData;
+
+      const int num_local_pads = NumLocalPads();
+      for (int local_pad = 0; local_pad < num_local_pads; local_pad++)
+      {
+        const int ingame_pad = LocalPadToInGamePad(local_pad);
+        const GCPadStatus status = GetLocalPadStatus(local_pad);
+        m_rollback.AddLocalInput(ingame_pad, status);
+        AddPadStateToPacket(ingame_pad, status, packet);
+      }
+
+      if (num_local_pads > 0)
+        SendAsync(std::move(packet));
+    }
+
+    // Wait when running further ahead would make a misprediction impossible to undo.
+    while (!m_rollback.CanGetInputs())
+    {
+      if (!m_is_running.IsSet())
+        return false;
+
+      m_gc_pad_event.Wait();
+    }
+
+    if (m_rollback.IsResimulating() != m_rollback_resimulating)
+      SetRollbackResimulating(!m_rollback_resimulating);
+
+    Core::System::GetInstance().GetCPU().InterruptWithJob([] {
+      std::lock_guard lk(crit_netplay_client);
+      if (netplay_client)
+        netplay_client->m_rollback.OnSafePoint();
+    });
   }
-  else if (Config::Get(Config::GetInfoForSIDevice(local_pad)) ==
-           SerialInterface::SIDEVICE_WIIU_ADAPTER)
+
+  *pad_status = m_rollback.GetInput(pad_nb);
+  return true;
+}
+
+void NetPlayClient::StartRollbackSession()
+{
+  if (m_rollback_resimulating)
+    SetRollbackResimulating(false);
+
+  // Wii Remotes keep using the delay-based buffers, which would get out of sync with a rollback.
+  const bool has_wiimotes =
+      std::ranges::any_of(m_net_settings.wiimote_map, [](auto mapping) { return mapping > 0; });
+  if (!m_net_settings.rollback || has_wiimotes)
   {
-    pad_status = GCAdapter::Input(local_pad);
+    if (m_net_settings.rollback)
+      WARN_LOG_FMT(NETPLAY, "The rollback network mode doesn't support Wii Remotes");
+
+    m_rollback.Stop();
+    return;
   }
-  else
+
+  std::array<Rollback::PadSource, 4> sources{};
+  for (size_t i = 0; i < sources.size(); ++i)
   {
-    pad_status = Pad::GetStatus(local_pad);
+    if (m_net_settings.pad_map[i] == m_local_player->pid)
+      sources[i] = Rollback::PadSource::Local;
+    else if (m_net_settings.pad_map[i] > 0)
+      sources[i] = Rollback::PadSource::Remote;
   }
 
+  m_rollback_states.Reset();
+  m_rollback.Start(
+      sources,
+      [this](u64 frame) { return m_rollback_states.Save(Core::System::GetInstance(), frame); },
+      [this](u64 frame) { return m_rollback_states.Load(Core::System::GetInstance(), frame); });
+}
+
+// Catch up with the other players as fast as possible after a rollback. The frames emulated again
+// have already been heard and seen, so they are neither played nor presented.
+void NetPlayClient::SetRollbackResimulating(bool resimulating)
+{
+  m_rollback_resimulating = resimulating;
+  Core::SetIsThrottlerTempDisabled(resimulating);
+
+  auto& system = Core::System::GetInstance();
+  if (SoundStream* const sound_stream = system.GetSoundStream())
+    sound_stream->GetMixer()->SetMuted(resimulating);
+  if (g_presenter)
+    g_presenter->SetSkipPresentation(resimulating);
+}
+
+GCPadStatus NetPlayClient::GetLocalPadStatus(const int local_pad) const
+{
+  const int ingame_pad = LocalPadToInGamePad(local_pad);
+
+  if (m_net_settings.gba_config[ingame_pad].enabled)
+    return Pad::GetGBAStatus(local_pad);
+
+  if (Config::Get(Config::GetInfoForSIDevice(local_pad)) == SerialInterface::SIDEVICE_WIIU_ADAPTER)
+    return GCAdapter::Input(local_pad);
+
+  return Pad::GetStatus(local_pad);
+}
+
+bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
+{
+  const int ingame_pad = LocalPadToInGamePad(local_pad);
+  bool data_added = false;
+  const GCPadStatus pad_status = GetLocalPadStatus(local_pad);
+
   if (m_host_input_authority)
   {
     if (m_local_player->pid != m_current_golfer)
@@ -2488,36 +2900,6 @@ bool NetPlayClient::DoAllPlayersHaveGame()
   });
 }
 
-static std::string SHA1Sum(const std::string& file_path,
-                           const std::function<bool(int)>& report_progress)
-{
-  std::vector<u8> data(8 * 1024 * 1024);
-  u64 read_offset = 0;
-
-  std::unique_ptr<DiscIO::BlobReader> file(DiscIO::CreateBlobReader(file_path));
-  u64 game_size = file->GetDataSize();
-
-  auto ctx = Common::SHA1::CreateContext();
-
-  while (read_offset < game_size)
-  {
-    size_t read_size = std::min(static_cast<u64>(data.size()), game_size - read_offset);
-    if (!file->Read(read_offset, read_size, data.data()))
-      return "";
-
-    ctx->Update(data.data(), read_size);
-    read_offset += read_size;
-
-    int progress =
-        static_cast<int>(static_cast<float>(read_offset) / static_cast<float>(game_size) * 100);
-    if (!report_progress(progress))
-      return "";
-  }
-
-  // Convert to hex
-  return fmt::format("{:02x}", fmt::join(ctx->Finish(), ""));
-}
-
 void NetPlayClient::ComputeGameDigest(const SyncIdentifier& sync_identifier)
 {
   if (m_should_compute_game_digest)
@@ -2543,8 +2925,13 @@ void NetPlayClient::ComputeGameDigest(const SyncIdentifier& sync_identifier)
 
   if (m_game_digest_thread.joinable())
     m_game_digest_thread.join();
+  {
+    std::lock_guard lk(m_game_digest_mutex);
+    m_game_digest.reset();
+  }
+
   m_game_digest_thread = std::thread([this, file] {
-    std::string sum = SHA1Sum(file, [&](int progress) {
+    std::optional<GameDigest> digest = NetPlay::ComputeGameDigest(file, [&](int progress) {
       sf::Packet packet;
       packet << MessageID::GameDigestProgress;
       packet << progress;
@@ -2555,7 +2942,29 @@ void NetPlayClient::ComputeGameDigest(const SyncIdentifier& sync_identifier)
 
     sf::Packet packet;
     packet << MessageID::GameDigestResult;
-    packet << sum;
+    if (digest)
+    {
+      // Also send the digest of every region, so that other players can tell where the
+      // difference is if the results don't match.
+      packet << Common::SHA1::DigestToString(digest->root);
+      packet << static_cast<u32>(digest->regions.size());
+      for (const Common::SHA1::Digest& region : digest->regions)
+      {
+        for (const u8 byte : region)
+          packet << byte;
+      }
+    }
+    else
+    {
+      packet << std::string{};
+      packet << u32{0};
+    }
+
+    {
+      std::lock_guard lk(m_game_digest_mutex);
+      m_game_digest = std::move(digest);
+    }
+
     SendAsync(std::move(packet));
   });
 }
@@ -9,17 +9,21 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/SPSCQueue.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayGameDigest.h"
 #include "Core/NetPlayProto.h"
+#include "Core/NetPlayRollback.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
 
@@ -203,6 +207,11 @@ protected:
   std::array<GCPadStatus, 4> m_last_pad_status{};
   std::array<bool, 4> m_first_pad_status_received{};
 
+  // Replaces m_pad_buffer when the host picked the rollback network mode.
+  Rollback::Session m_rollback;
+  Rollback::StateBuffer m_rollback_states;
+  bool m_rollback_resimulating = false;
+
   std::chrono::time_point<std::chrono::steady_clock> m_buffer_under_target_last;
 
   NetPlayUI* m_dialog = nullptr;
@@ -251,7 +260,11 @@ private:
   void SyncSaveDataResponse(bool success);
   void SyncCodeResponse(bool success);
 
+  GCPadStatus GetLocalPadStatus(int local_pad) const;
   bool PollLocalPad(int local_pad, sf::Packet& packet);
+  bool GetRollbackPads(int pad_nb, bool batching, GCPadStatus* pad_status);
+  void StartRollbackSession();
+  void SetRollbackResimulating(bool resimulating);
   void SendPadHostPoll(PadIndex pad_num);
 
   bool AddLocalWiimoteToBuffer(int local_wiimote, const WiimoteEmu::SerializedWiimoteState& state,
@@ -297,7 +310,11 @@ private:
   void OnSyncSaveData(sf::Packet& packet);
   void OnSyncSaveDataNotify(sf::Packet& packet);
   void OnSyncSaveDataRaw(sf::Packet& packet);
+  void OnSyncSaveDataRawHashes(sf::Packet& packet);
+  void OnSyncSaveDataRawBlocks(sf::Packet& packet);
   void OnSyncSaveDataGCI(sf::Packet& packet);
+  void OnSyncSaveDataGCIHashes(sf::Packet& packet);
+  void OnSyncSaveDataGCIBlocks(sf::Packet& packet);
   void OnSyncSaveDataWii(sf::Packet& packet);
   void OnSyncSaveDataGBA(sf::Packet& packet);
   void OnSyncCodes(sf::Packet& packet);
@@ -323,6 +340,9 @@ private:
   bool m_connecting = false;
   Common::TraversalClient* m_traversal_client = nullptr;
   std::thread m_game_digest_thread;
+  // The digest this client computed, to compare it with the other players' ones.
+  std::mutex m_game_digest_mutex;
+  std::optional<GameDigest> m_game_digest;
   bool m_should_compute_game_digest = false;
   Common::Event m_gc_pad_event;
   Common::Event m_wii_pad_event;
@@ -330,6 +350,21 @@ private:
   Common::Event m_wait_on_input_event;
   u8 m_sync_save_data_count = 0;
   u8 m_sync_save_data_success_count = 0;
+  // Raw memory cards waiting for the blocks that were requested from the server.
+  struct RawMemcardSync
+  {
+    std::string path;
+    std::vector<u8> data;
+  };
+  std::array<RawMemcardSync, 2> m_raw_memcard_sync;
+  // Same for GCI folders. The files are written once all of them are complete, replacing the
+  // folder's previous contents.
+  struct GCIFolderSync
+  {
+    std::string path;
+    std::vector<std::pair<std::string, std::vector<u8>>> files;
+  };
+  std::array<GCIFolderSync, 2> m_gci_folder_sync;
   u16 m_sync_gecko_codes_count = 0;
   u16 m_sync_gecko_codes_success_count = 0;
   bool m_sync_gecko_codes_complete = false;
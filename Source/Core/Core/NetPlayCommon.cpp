@@ -6,7 +6,9 @@
 #include <algorithm>
 
 #include <fmt/format.h>
+#include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <xxhash.h>
 
 #include "Common/FileUtil.h"
 #include "Common/HttpRequest.h"
@@ -336,6 +338,134 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
   return out_buffer;
 }
 
+static std::span<const u8> GetBlock(std::span<const u8> data, size_t index)
+{
+  const size_t offset = index * SAVE_SYNC_BLOCK_SIZE;
+  return data.subspan(offset, std::min(SAVE_SYNC_BLOCK_SIZE, data.size() - offset));
+}
+
+static size_t GetBlockCount(size_t size)
+{
+  return (size + SAVE_SYNC_BLOCK_SIZE - 1) / SAVE_SYNC_BLOCK_SIZE;
+}
+
+std::vector<u64> ComputeBlockHashes(std::span<const u8> data)
+{
+  std::vector<u64> hashes(GetBlockCount(data.size()));
+  for (size_t i = 0; i < hashes.size(); ++i)
+  {
+    const std::span<const u8> block = GetBlock(data, i);
+    hashes[i] = XXH3_64bits(block.data(), block.size());
+  }
+  return hashes;
+}
+
+std::vector<u32> FindChangedBlocks(std::span<const u8> data, std::span<const u64> remote_hashes)
+{
+  const std::vector<u64> hashes = ComputeBlockHashes(data);
+
+  std::vector<u32> changed_blocks;
+  for (size_t i = 0; i < remote_hashes.size(); ++i)
+  {
+    if (i >= hashes.size() || hashes[i] != remote_hashes[i])
+      changed_blocks.push_back(static_cast<u32>(i));
+  }
+  return changed_blocks;
+}
+
+// The blocks are compressed with LZ4 rather than LZO, since save data is usually sent right
+// before the game starts and compression speed matters more than ratio there.
+bool CompressBlocksIntoPacket(std::span<const u8> data, std::span<const u32> block_indices,
+                              sf::Packet& packet)
+{
+  std::vector<u8> blocks;
+  blocks.reserve(block_indices.size() * SAVE_SYNC_BLOCK_SIZE);
+
+  packet << static_cast<u32>(block_indices.size());
+  for (const u32 index : block_indices)
+  {
+    if (index >= GetBlockCount(data.size()))
+      return false;
+
+    packet << index;
+    const std::span<const u8> block = GetBlock(data, index);
+    blocks.insert(blocks.end(), block.begin(), block.end());
+  }
+
+  if (blocks.size() > static_cast<size_t>(LZ4_MAX_INPUT_SIZE))
+    return false;
+
+  std::vector<u8> compressed(LZ4_compressBound(static_cast<int>(blocks.size())));
+  const int compressed_size =
+      LZ4_compress_default(reinterpret_cast<const char*>(blocks.data()),
+                           reinterpret_cast<char*>(compressed.data()),
+                           static_cast<int>(blocks.size()), static_cast<int>(compressed.size()));
+  if (compressed_size <= 0)
+  {
+    PanicAlertFmtT("Internal LZ4 Error - compression failed");
+    return false;
+  }
+
+  packet << static_cast<u32>(blocks.size()) << static_cast<u32>(compressed_size);
+  packet.append(compressed.data(), compressed_size);
+  return true;
+}
+
+bool DecompressPacketIntoBlocks(sf::Packet& packet, std::span<u8> data)
+{
+  const size_t block_count = GetBlockCount(data.size());
+
+  u32 count = 0;
+  packet >> count;
+  if (count > block_count)
+    return false;
+
+  size_t expected_size = 0;
+  std::vector<u32> block_indices(count);
+  for (u32& index : block_indices)
+  {
+    packet >> index;
+    if (index >= block_count)
+      return false;
+    expected_size += GetBlock(data, index).size();
+  }
+
+  u32 size = 0;
+  u32 compressed_size = 0;
+  packet >> size >> compressed_size;
+  if (!packet || size != expected_size || size > static_cast<u32>(LZ4_MAX_INPUT_SIZE) ||
+      compressed_size > static_cast<u32>(LZ4_compressBound(static_cast<int>(size))))
+  {
+    return false;
+  }
+
+  std::vector<u8> compressed(compressed_size);
+  for (u8& byte : compressed)
+    packet >> byte;
+  if (!packet)
+    return false;
+
+  std::vector<u8> blocks(size);
+  const int decompressed_size = LZ4_decompress_safe(
+      reinterpret_cast<const char*>(compressed.data()), reinterpret_cast<char*>(blocks.data()),
+      static_cast<int>(compressed.size()), static_cast<int>(blocks.size()));
+  if (decompressed_size != static_cast<int>(size))
+  {
+    PanicAlertFmtT("Internal LZ4 Error - decompression failed");
+    return false;
+  }
+
+  size_t offset = 0;
+  for (const u32 index : block_indices)
+  {
+    const size_t block_offset = index * SAVE_SYNC_BLOCK_SIZE;
+    const size_t block_size = GetBlock(data, index).size();
+    std::copy_n(blocks.begin() + offset, block_size, data.begin() + block_offset);
+    offset += block_size;
+  }
+  return true;
+}
+
 std::string GetExternalIPAddress()
 {
   Common::HttpRequest request;
@@ -28,4 +28,16 @@ bool CompressBufferIntoPacket(std::span<const u8> in_buffer, sf::Packet& packet)
 bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
 bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path);
 std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
+
+// Large save data is synchronized in blocks of this size, so that clients which already have most
+// of it only need to receive the blocks that differ.
+constexpr size_t SAVE_SYNC_BLOCK_SIZE = 0x2000;
+
+std::vector<u64> ComputeBlockHashes(std::span<const u8> data);
+// Returns the indices of the blocks of `data` that differ from the given hashes of the remote data.
+// `data` must already have the size of the remote data.
+std::vector<u32> FindChangedBlocks(std::span<const u8> data, std::span<const u64> remote_hashes);
+bool CompressBlocksIntoPacket(std::span<const u8> data, std::span<const u32> block_indices,
+                              sf::Packet& packet);
+bool DecompressPacketIntoBlocks(sf::Packet& packet, std::span<u8> data);
 }  // namespace NetPlay
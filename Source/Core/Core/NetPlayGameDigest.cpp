@@ -0,0 +1,243 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayGameDigest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "DiscIO/Blob.h"
+
+namespace NetPlay
+{
+namespace
+{
+constexpr u64 READ_SIZE = 8 * 1024 * 1024;
+constexpr u32 MAX_THREADS = 8;
+
+constexpr u32 CACHE_MAGIC = 0x31434447;  // "GDC1"
+
+struct CacheHeader
+{
+  u32 magic = CACHE_MAGIC;
+  u32 region_count = 0;
+  u64 region_size = GAME_DIGEST_REGION_SIZE;
+  u64 file_size = 0;
+  s64 file_time = 0;
+
+  bool operator==(const CacheHeader&) const = default;
+};
+static_assert(std::is_trivially_copyable_v<CacheHeader>);
+
+struct CachedRegion
+{
+  u8 valid = 0;
+  Common::SHA1::Digest digest{};
+};
+static_assert(std::is_trivially_copyable_v<CachedRegion>);
+
+using RegionDigests = std::vector<std::optional<Common::SHA1::Digest>>;
+
+std::string GetCachePath(const std::string& file_path)
+{
+  return File::GetUserPath(D_CACHE_IDX) + "GameDigests" DIR_SEP +
+         Common::SHA1::DigestToString(Common::SHA1::CalculateDigest(file_path)) + ".bin";
+}
+
+// Identifies the current version of the file, so that stale digests are never used.
+std::optional<CacheHeader> GetCacheHeader(const std::string& file_path, size_t region_count)
+{
+  std::error_code error;
+  const std::filesystem::path path = StringToPath(file_path);
+  const auto file_size = std::filesystem::file_size(path, error);
+  if (error)
+    return std::nullopt;
+  const auto file_time = std::filesystem::last_write_time(path, error);
+  if (error)
+    return std::nullopt;
+
+  CacheHeader header;
+  header.region_count = static_cast<u32>(region_count);
+  header.file_size = file_size;
+  header.file_time = static_cast<s64>(file_time.time_since_epoch().count());
+  return header;
+}
+
+RegionDigests LoadCache(const std::string& cache_path, const CacheHeader& expected_header)
+{
+  RegionDigests regions(expected_header.region_count);
+
+  File::IOFile file(cache_path, "rb");
+  CacheHeader header;
+  if (!file || !file.ReadArray(&header, 1) || header != expected_header)
+    return regions;
+
+  std::vector<CachedRegion> cached(header.region_count);
+  if (!file.ReadArray(cached.data(), cached.size()))
+    return regions;
+
+  for (size_t i = 0; i < cached.size(); ++i)
+  {
+    if (cached[i].valid)
+      regions[i] = cached[i].digest;
+  }
+  return regions;
+}
+
+void SaveCache(const std::string& cache_path, const CacheHeader& header,
+               const RegionDigests& regions)
+{
+  std::vector<CachedRegion> cached(regions.size());
+  for (size_t i = 0; i < regions.size(); ++i)
+  {
+    if (regions[i])
+      cached[i] = {.valid = 1, .digest = *regions[i]};
+  }
+
+  File::CreateFullPath(cache_path);
+  File::IOFile file(cache_path, "wb");
+  if (!file || !file.WriteArray(&header, 1) || !file.WriteArray(cached.data(), cached.size()))
+    WARN_LOG_FMT(NETPLAY, "Failed to write game digest cache {}", cache_path);
+}
+}  // namespace
+
+std::optional<GameDigest> ComputeGameDigest(const std::string& file_path,
+                                            const std::function<bool(int)>& report_progress)
+{
+  std::unique_ptr<DiscIO::BlobReader> blob = DiscIO::CreateBlobReader(file_path);
+  if (!blob)
+    return std::nullopt;
+
+  const u64 data_size = blob->GetDataSize();
+  const size_t region_count = (data_size + GAME_DIGEST_REGION_SIZE - 1) / GAME_DIGEST_REGION_SIZE;
+  if (region_count > MAX_GAME_DIGEST_REGIONS)
+  {
+    ERROR_LOG_FMT(NETPLAY, "{} is too big for a game digest", file_path);
+    return std::nullopt;
+  }
+  const auto get_region_size = [&](size_t region) {
+    return std::min(GAME_DIGEST_REGION_SIZE, data_size - region * GAME_DIGEST_REGION_SIZE);
+  };
+
+  const std::string cache_path = GetCachePath(file_path);
+  const std::optional<CacheHeader> cache_header = GetCacheHeader(file_path, region_count);
+  RegionDigests regions =
+      cache_header ? LoadCache(cache_path, *cache_header) : RegionDigests(region_count);
+
+  u64 done_bytes = 0;
+  std::vector<size_t> pending_regions;
+  for (size_t i = 0; i < region_count; ++i)
+  {
+    if (regions[i])
+      done_bytes += get_region_size(i);
+    else
+      pending_regions.push_back(i);
+  }
+
+  if (!pending_regions.empty())
+  {
+    INFO_LOG_FMT(NETPLAY, "Computing game digest of {}: {} of {} regions cached", file_path,
+                 region_count - pending_regions.size(), region_count);
+  }
+
+  std::mutex progress_mutex;
+  std::atomic<bool> stop = false;
+  std::atomic<bool> failed = false;
+  std::atomic<size_t> next_pending_region = 0;
+
+  const auto add_progress = [&](u64 bytes) {
+    std::lock_guard lk(progress_mutex);
+    done_bytes += bytes;
+    const int progress = data_size == 0 ? 100 : static_cast<int>(done_bytes * 100 / data_size);
+    return report_progress(progress);
+  };
+
+  const auto hash_regions = [&](std::unique_ptr<DiscIO::BlobReader> reader) {
+    std::vector<u8> buffer(READ_SIZE);
+    while (!stop)
+    {
+      const size_t pending_index = next_pending_region++;
+      if (pending_index >= pending_regions.size())
+        return;
+
+      const size_t region = pending_regions[pending_index];
+      const u64 region_offset = region * GAME_DIGEST_REGION_SIZE;
+      const u64 region_size = get_region_size(region);
+
+      auto ctx = Common::SHA1::CreateContext();
+      for (u64 offset = 0; offset < region_size; offset += READ_SIZE)
+      {
+        const u64 read_size = std::min(READ_SIZE, region_size - offset);
+        if (!reader->Read(region_offset + offset, read_size, buffer.data()))
+        {
+          failed = true;
+          stop = true;
+          return;
+        }
+        ctx->Update(buffer.data(), read_size);
+
+        if (!add_progress(read_size))
+        {
+          stop = true;
+          return;
+        }
+      }
+
+      // Each region is only ever written by one thread.
+      regions[region] = ctx->Finish();
+    }
+  };
+
+  const u32 thread_count = static_cast<u32>(std::min<size_t>(
+      std::clamp(std::thread::hardware_concurrency(), 1u, MAX_THREADS), pending_regions.size()));
+  std::vector<std::thread> threads;
+  for (u32 i = 1; i < thread_count; ++i)
+  {
+    if (auto reader = blob->CopyReader())
+      threads.emplace_back(hash_regions, std::move(reader));
+  }
+  if (pending_regions.empty())
+    stop = !add_progress(0);
+  else
+    hash_regions(std::move(blob));
+  for (std::thread& thread : threads)
+    thread.join();
+
+  // Also keep the progress of an aborted computation.
+  if (cache_header && !pending_regions.empty())
+    SaveCache(cache_path, *cache_header, regions);
+
+  if (stop || failed)
+    return std::nullopt;
+
+  GameDigest digest;
+  digest.regions.reserve(region_count);
+  auto ctx = Common::SHA1::CreateContext();
+  for (const auto& region : regions)
+  {
+    digest.regions.push_back(*region);
+    ctx->Update(region->data(), region->size());
+  }
+  digest.root = ctx->Finish();
+  return digest;
+}
+
+std::optional<size_t> FindFirstDifferentRegion(const GameDigest& a, const GameDigest& b)
+{
+  const auto [it_a, it_b] = std::ranges::mismatch(a.regions, b.regions);
+  if (it_a != a.regions.end() || it_b != b.regions.end())
+    return static_cast<size_t>(it_a - a.regions.begin());
+  return std::nullopt;
+}
+}  // namespace NetPlay
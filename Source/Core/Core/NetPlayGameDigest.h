@@ -0,0 +1,40 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+
+namespace NetPlay
+{
+// The data of the game is split into regions of this size, which are hashed independently.
+// Disc image formats use power of two block sizes no larger than this, so regions always start
+// at a block boundary of the underlying file.
+constexpr u64 GAME_DIGEST_REGION_SIZE = 64 * 1024 * 1024;
+// Even the largest discs have far fewer regions than this. Bigger files aren't digested, so that
+// digests received from other players can be rejected if they claim more.
+constexpr u32 MAX_GAME_DIGEST_REGIONS = 1024;
+
+struct GameDigest
+{
+  // SHA-1 of each region of the data.
+  std::vector<Common::SHA1::Digest> regions;
+  // SHA-1 of all the region digests.
+  Common::SHA1::Digest root{};
+};
+
+// Hashes the regions on multiple threads. Region digests are cached on disk, so that the same
+// unmodified file doesn't have to be read again, even if a previous computation was aborted.
+// report_progress receives a percentage and returns false to abort.
+std::optional<GameDigest> ComputeGameDigest(const std::string& file_path,
+                                            const std::function<bool(int)>& report_progress);
+
+// Returns the index of the first region that differs between the two digests, if any.
+std::optional<size_t> FindFirstDifferentRegion(const GameDigest& a, const GameDigest& b);
+}  // namespace NetPlay
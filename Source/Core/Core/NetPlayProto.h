@@ -120,6 +120,7 @@ struct NetSettings
   bool sync_codes = false;
   std::string save_data_region;
   bool golf_mode = false;
+  bool rollback = false;
   bool use_fma = false;
   bool hide_remote_gbas = false;
 
@@ -229,7 +230,16 @@ enum class SyncSaveDataID : u8
   RawData = 3,
   GCIData = 4,
   WiiData = 5,
-  GBAData = 6
+  GBAData = 6,
+  // Raw memory cards are sent in three steps: the server sends the hashes of the card's blocks,
+  // the client requests the blocks it doesn't already have, and the server sends only those.
+  RawDataHashes = 7,
+  RawDataRequest = 8,
+  RawDataBlocks = 9,
+  // Same for GCI folders, with the hashes and blocks of each of the game's GCI files.
+  GCIDataHashes = 10,
+  GCIDataRequest = 11,
+  GCIDataBlocks = 12
 };
 
 enum class SyncCodeID : u8
@@ -0,0 +1,281 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayRollback.h"
+
+#include <span>
+#include <tuple>
+#include <utility>
+
+#include "Common/Assert.h"
+#include "Common/Logging/Log.h"
+#include "Core/State.h"
+#include "Core/System.h"
+#include "VideoCommon/Fifo.h"
+
+namespace NetPlay::Rollback
+{
+bool PadStatusEquals(const GCPadStatus& a, const GCPadStatus& b)
+{
+  const auto fields = [](const GCPadStatus& s) {
+    return std::tie(s.button, s.stickX, s.stickY, s.substickX, s.substickY, s.triggerLeft,
+                    s.triggerRight, s.analogA, s.analogB, s.switches, s.isConnected);
+  };
+  return fields(a) == fields(b);
+}
+
+bool InputHistory::CanGetInput(u64 frame) const
+{
+  return frame < m_first_unconfirmed_frame + MAX_ROLLBACK_FRAMES;
+}
+
+GCPadStatus InputHistory::GetInput(u64 frame)
+{
+  Entry& entry = GetEntry(frame);
+  if (entry.valid && entry.frame == frame)
+    return entry.status;
+
+  ASSERT(frame >= m_first_unconfirmed_frame && CanGetInput(frame));
+  entry = {.frame = frame, .status = m_last_confirmed_status, .valid = true, .predicted = true};
+  return entry.status;
+}
+
+bool InputHistory::Confirm(u64 frame, const GCPadStatus& status)
+{
+  ASSERT(frame == m_first_unconfirmed_frame);
+
+  Entry& entry = GetEntry(frame);
+  const bool mispredicted = entry.valid && entry.frame == frame && entry.predicted &&
+                            !PadStatusEquals(entry.status, status);
+
+  entry = {.frame = frame, .status = status, .valid = true, .predicted = false};
+  m_last_confirmed_status = status;
+  ++m_first_unconfirmed_frame;
+
+  // The following frames are going to be emulated again, so predict them again too.
+  if (mispredicted)
+  {
+    for (u64 i = m_first_unconfirmed_frame; CanGetInput(i); ++i)
+    {
+      Entry& later_entry = GetEntry(i);
+      if (later_entry.valid && later_entry.frame == i && later_entry.predicted)
+        later_entry.status = status;
+    }
+  }
+
+  return mispredicted;
+}
+
+void InputHistory::Reset()
+{
+  m_entries = {};
+  m_last_confirmed_status = {};
+  m_first_unconfirmed_frame = 0;
+}
+
+// States are saved and loaded from a CPU thread job, not through Core::PauseAndLock, so the GPU
+// thread has to be synced and paused here like Core::PauseAndLock does for the regular savestates.
+bool StateBuffer::Save(Core::System& system, u64 frame)
+{
+  Slot& slot = m_slots[frame % m_slots.size()];
+  slot.frame.reset();
+
+  auto& fifo = system.GetFifo();
+  fifo.PauseAndLock();
+  slot.size = State::SaveToBuffer(system, slot.buffer);
+  fifo.RestoreState(true);
+  if (slot.size == 0)
+    return false;
+
+  slot.frame = frame;
+  return true;
+}
+
+bool StateBuffer::Load(Core::System& system, u64 frame)
+{
+  if (!HasState(frame))
+    return false;
+
+  Slot& slot = m_slots[frame % m_slots.size()];
+  auto& fifo = system.GetFifo();
+  fifo.PauseAndLock();
+  const bool loaded = State::LoadFromBuffer(system, std::span(slot.buffer.data(), slot.size));
+  fifo.RestoreState(true);
+  return loaded;
+}
+
+bool StateBuffer::HasState(u64 frame) const
+{
+  return m_slots[frame % m_slots.size()].frame == frame;
+}
+
+void StateBuffer::Reset()
+{
+  // Keep the buffers around, states of the same game are always about the same size.
+  for (Slot& slot : m_slots)
+    slot.frame.reset();
+}
+
+void Session::Start(const std::array<PadSource, 4>& sources, StateFunction save_state,
+                    StateFunction load_state)
+{
+  m_sources = sources;
+  m_save_state = std::move(save_state);
+  m_load_state = std::move(load_state);
+
+  m_current_frame.reset();
+  m_first_new_frame = 0;
+  m_saved_frames = {};
+  m_rollback_count = 0;
+
+  {
+    std::lock_guard lk(m_input_lock);
+    for (InputHistory& history : m_inputs)
+      history.Reset();
+    m_mispredicted_frame.reset();
+  }
+
+  m_active = true;
+}
+
+void Session::Stop()
+{
+  m_active = false;
+}
+
+void Session::AddRemoteInput(int pad, const GCPadStatus& status)
+{
+  if (pad < 0 || pad >= static_cast<int>(m_sources.size()) || m_sources[pad] != PadSource::Remote)
+    return;
+
+  std::lock_guard lk(m_input_lock);
+  InputHistory& history = m_inputs[pad];
+  const u64 frame = history.GetFirstUnconfirmedFrame();
+  if (history.Confirm(frame, status) && (!m_mispredicted_frame || frame < *m_mispredicted_frame))
+    m_mispredicted_frame = frame;
+}
+
+bool Session::BeginFrame()
+{
+  const u64 frame = GetNextFrame();
+  m_current_frame = frame;
+  if (frame < m_first_new_frame)
+    return false;
+
+  m_first_new_frame = frame + 1;
+  return true;
+}
+
+void Session::AddLocalInput(int pad, const GCPadStatus& status)
+{
+  std::lock_guard lk(m_input_lock);
+  m_inputs[pad].Confirm(*m_current_frame, status);
+}
+
+bool Session::CanGetInputs() const
+{
+  if (!m_current_frame)
+    return true;
+
+  const u64 frame = *m_current_frame;
+
+  std::lock_guard lk(m_input_lock);
+  for (size_t pad = 0; pad < m_sources.size(); ++pad)
+  {
+    if (m_sources[pad] != PadSource::Remote)
+      continue;
+
+    const InputHistory& history = m_inputs[pad];
+    const u64 first_unconfirmed_frame = history.GetFirstUnconfirmedFrame();
+    if (frame < first_unconfirmed_frame)
+      continue;
+
+    // Predicting is only possible if a misprediction can be undone by loading the state of the
+    // frame before the first unconfirmed one. That state can't be overwritten before the real
+    // input arrives, since the window is one frame shorter than the state buffer.
+    if (first_unconfirmed_frame == 0 || !HasSavedFrame(first_unconfirmed_frame - 1) ||
+        !history.CanGetInput(frame))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+GCPadStatus Session::GetInput(int pad)
+{
+  if (!m_current_frame || m_sources[pad] == PadSource::None)
+    return {};
+
+  std::lock_guard lk(m_input_lock);
+  return m_inputs[pad].GetInput(*m_current_frame);
+}
+
+void Session::OnSafePoint()
+{
+  if (!m_active || !m_current_frame)
+    return;
+
+  std::optional<u64> mispredicted_frame;
+  {
+    std::lock_guard lk(m_input_lock);
+    mispredicted_frame = std::exchange(m_mispredicted_frame, std::nullopt);
+  }
+
+  // A misprediction past the current frame was made before an earlier rollback. That frame
+  // hasn't been emulated again yet, and it will be with the real input.
+  if (mispredicted_frame && *mispredicted_frame <= *m_current_frame)
+  {
+    // The state of the current frame hasn't been saved yet, so the one a full buffer before it is
+    // still there.
+    std::optional<u64> rollback_frame;
+    for (u64 frame = *mispredicted_frame;
+         frame-- > 0 && *m_current_frame - frame <= m_saved_frames.size();)
+    {
+      if (HasSavedFrame(frame))
+      {
+        rollback_frame = frame;
+        break;
+      }
+    }
+
+    if (rollback_frame && m_load_state(*rollback_frame))
+    {
+      // The states of the frames after it belong to the mispredicted timeline.
+      for (std::optional<u64>& saved_frame : m_saved_frames)
+      {
+        if (saved_frame > rollback_frame)
+          saved_frame.reset();
+      }
+
+      m_current_frame = rollback_frame;
+      ++m_rollback_count;
+      return;
+    }
+
+    ERROR_LOG_FMT(NETPLAY, "Could not roll back to before frame {}", *mispredicted_frame);
+  }
+
+  const u64 frame = *m_current_frame;
+  std::optional<u64>& saved_frame = m_saved_frames[frame % m_saved_frames.size()];
+  saved_frame.reset();
+  if (m_save_state(frame))
+    saved_frame = frame;
+}
+
+bool Session::IsResimulating() const
+{
+  return m_current_frame && *m_current_frame + 1 < m_first_new_frame;
+}
+
+bool Session::HasSavedFrame(u64 frame) const
+{
+  return m_saved_frames[frame % m_saved_frames.size()] == frame;
+}
+
+u64 Session::GetNextFrame() const
+{
+  return m_current_frame ? *m_current_frame + 1 : 0;
+}
+}  // namespace NetPlay::Rollback
@@ -0,0 +1,165 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace Core
+{
+class System;
+}
+
+// Building blocks for rollback netcode.
+//
+// Instead of waiting for remote inputs to arrive, the emulation runs ahead with predicted inputs.
+// When the real input of a frame turns out to differ from the prediction, the state saved at that
+// frame is loaded and the following frames are emulated again with the corrected inputs.
+namespace NetPlay::Rollback
+{
+// How far the emulation may run ahead of the last confirmed input of any pad.
+constexpr u32 MAX_ROLLBACK_FRAMES = 8;
+
+bool PadStatusEquals(const GCPadStatus& a, const GCPadStatus& b);
+
+// Inputs of one in-game pad, indexed by frame number.
+class InputHistory
+{
+public:
+  // Whether the input of `frame` can be returned without exceeding the rollback window.
+  bool CanGetInput(u64 frame) const;
+
+  // Returns the real input of `frame` if it is known. Otherwise, predicts that the last known
+  // input is still held and remembers the prediction.
+  GCPadStatus GetInput(u64 frame);
+
+  // Records the real input of the next unconfirmed frame. Inputs must be confirmed in order.
+  // Returns true if a different input was predicted for this frame, in which case the frames
+  // starting at `frame` have to be emulated again.
+  bool Confirm(u64 frame, const GCPadStatus& status);
+
+  // All the frames before this one have their real input.
+  u64 GetFirstUnconfirmedFrame() const { return m_first_unconfirmed_frame; }
+
+  void Reset();
+
+private:
+  struct Entry
+  {
+    u64 frame = 0;
+    GCPadStatus status;
+    bool valid = false;
+    bool predicted = false;
+  };
+
+  Entry& GetEntry(u64 frame) { return m_entries[frame % m_entries.size()]; }
+
+  // Remote inputs can be confirmed up to a window ahead of the newest emulated frame, while a
+  // resimulation can read inputs up to a window behind it.
+  std::array<Entry, MAX_ROLLBACK_FRAMES * 4> m_entries{};
+  GCPadStatus m_last_confirmed_status;
+  u64 m_first_unconfirmed_frame = 0;
+};
+
+// In-memory states of the last frames, to roll back to.
+class StateBuffer
+{
+public:
+  // Must be called on the CPU thread.
+  bool Save(Core::System& system, u64 frame);
+  bool Load(Core::System& system, u64 frame);
+
+  bool HasState(u64 frame) const;
+  void Reset();
+
+private:
+  struct Slot
+  {
+    std::optional<u64> frame;
+    Common::UniqueBuffer<u8> buffer;
+    size_t size = 0;
+  };
+
+  // One more than the window, since the oldest unconfirmed frame itself needs a state.
+  std::array<Slot, MAX_ROLLBACK_FRAMES + 1> m_slots;
+};
+
+enum class PadSource
+{
+  None,
+  Local,
+  Remote,
+};
+
+// Runs the input side of a rollback session for the GameCube pads.
+//
+// A frame begins on each VI poll of the first in-game pad, and every poll until the next one reads
+// the inputs of that frame. The local inputs of a frame are added when it begins for the first
+// time. Remote inputs arrive in frame order from the network and are predicted until then.
+//
+// Right after a frame began, once the CPU thread is outside of JIT code, OnSafePoint() saves the
+// state. If a remote input has been mispredicted in the meantime, it loads the state of the frame
+// before instead, so that the next frames are emulated again with the real input.
+class Session
+{
+public:
+  using StateFunction = std::function<bool(u64 frame)>;
+
+  void Start(const std::array<PadSource, 4>& sources, StateFunction save_state,
+             StateFunction load_state);
+  void Stop();
+  bool IsActive() const { return m_active; }
+
+  // Called from the network thread.
+  void AddRemoteInput(int pad, const GCPadStatus& status);
+
+  // Called from the CPU thread.
+
+  // Returns true if the frame is emulated for the first time, in which case the local inputs have
+  // to be added to it.
+  bool BeginFrame();
+  void AddLocalInput(int pad, const GCPadStatus& status);
+  // Whether the inputs of the current frame can be read without running further ahead of the
+  // remote inputs than a rollback could undo. Otherwise, wait for more remote inputs.
+  bool CanGetInputs() const;
+  // The input of the current frame. Polls that happen before the first frame get a neutral input
+  // on every player's side.
+  GCPadStatus GetInput(int pad);
+
+  // Called from the CPU thread outside of JIT code, after a frame began.
+  void OnSafePoint();
+
+  // Whether the current frame has already been emulated once before a rollback.
+  bool IsResimulating() const;
+  u32 GetRollbackCount() const { return m_rollback_count; }
+
+private:
+  bool HasSavedFrame(u64 frame) const;
+  u64 GetNextFrame() const;
+
+  std::array<PadSource, 4> m_sources{};
+  StateFunction m_save_state;
+  StateFunction m_load_state;
+  // Only changed while no game is running.
+  bool m_active = false;
+
+  // Only used on the CPU thread.
+  std::optional<u64> m_current_frame;
+  u64 m_first_new_frame = 0;
+  std::array<std::optional<u64>, MAX_ROLLBACK_FRAMES + 1> m_saved_frames;
+  u32 m_rollback_count = 0;
+
+  // Protects the input histories, which both the CPU and the network thread use.
+  mutable std::mutex m_input_lock;
+  std::array<InputHistory, 4> m_inputs;
+  std::optional<u64> m_mispredicted_frame;
+};
+}  // namespace NetPlay::Rollback
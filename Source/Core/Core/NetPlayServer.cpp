@@ -11,6 +11,7 @@
 #include <mutex>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -22,6 +23,7 @@
 #include <fmt/ranges.h>
 
 #include "Common/CommonPaths.h"
+#include "Common/Crypto/SHA1.h"
 #include "Common/ENet.h"
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
@@ -60,6 +62,7 @@
 #include "Core/IOS/Uids.h"
 #include "Core/NetPlayClient.h"  //for NetPlayUI
 #include "Core/NetPlayCommon.h"
+#include "Core/NetPlayGameDigest.h"
 #include "Core/SyncIdentifier.h"
 
 #include "DiscIO/Enums.h"
@@ -1128,12 +1131,24 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   case MessageID::GameDigestResult:
   {
     std::string result;
+    u32 region_count;
     packet >> result;
+    packet >> region_count;
+
+    if (!packet || region_count > MAX_GAME_DIGEST_REGIONS)
+      return 1;
 
     sf::Packet spac;
     spac << MessageID::GameDigestResult;
     spac << player.pid;
     spac << result;
+    spac << region_count;
+    for (u32 i = 0; i < region_count * Common::SHA1::DIGEST_LEN; ++i)
+    {
+      u8 byte;
+      packet >> byte;
+      spac << byte;
+    }
 
     SendToClients(spac);
   }
@@ -1176,6 +1191,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
 
           // Saves are synced, check if codes are as well and attempt to start the game
           m_saves_synced = true;
+          ClearSaveSyncData();
           CheckSyncAndStartGame();
         }
         else
@@ -1191,12 +1207,91 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     }
     break;
 
+    case SyncSaveDataID::RawDataRequest:
+    {
+      bool is_slot_a;
+      u32 count;
+      packet >> is_slot_a >> count;
+
+      std::lock_guard lkg(m_crit.game);
+      const std::vector<u8>& data =
+          m_raw_memcard_sync_data[is_slot_a ? ExpansionInterface::Slot::A :
+                                              ExpansionInterface::Slot::B];
+      if (!packet || count > data.size() / SAVE_SYNC_BLOCK_SIZE + 1)
+        return 1;
+
+      std::vector<u32> block_indices(count);
+      for (u32& index : block_indices)
+        packet >> index;
+
+      INFO_LOG_FMT(NETPLAY, "Sending {} blocks of raw memcard in slot {} to player {}.", count,
+                   is_slot_a ? 'A' : 'B', player.pid);
+
+      sf::Packet pac;
+      pac << MessageID::SyncSaveData;
+      pac << SyncSaveDataID::RawDataBlocks;
+      pac << is_slot_a;
+      if (!packet || !CompressBlocksIntoPacket(data, block_indices, pac))
+        return 1;
+
+      SendChunked(std::move(pac), player.pid,
+                  fmt::format("Memory Card {} Synchronization", is_slot_a ? 'A' : 'B'));
+    }
+    break;
+
+    case SyncSaveDataID::GCIDataRequest:
+    {
+      bool is_slot_a;
+      u8 file_count;
+      packet >> is_slot_a >> file_count;
+
+      std::lock_guard lkg(m_crit.game);
+      const std::vector<std::vector<u8>>& files =
+          m_gci_folder_sync_data[is_slot_a ? ExpansionInterface::Slot::A :
+                                             ExpansionInterface::Slot::B];
+      if (!packet || file_count > files.size())
+        return 1;
+
+      INFO_LOG_FMT(NETPLAY, "Sending blocks of {} GCI files in slot {} to player {}.", file_count,
+                   is_slot_a ? 'A' : 'B', player.pid);
+
+      sf::Packet pac;
+      pac << MessageID::SyncSaveData;
+      pac << SyncSaveDataID::GCIDataBlocks;
+      pac << is_slot_a << file_count;
+
+      for (u8 i = 0; i < file_count; ++i)
+      {
+        u8 file_index;
+        u32 count;
+        packet >> file_index >> count;
+        if (!packet || file_index >= files.size() ||
+            count > files[file_index].size() / SAVE_SYNC_BLOCK_SIZE + 1)
+        {
+          return 1;
+        }
+
+        std::vector<u32> block_indices(count);
+        for (u32& index : block_indices)
+          packet >> index;
+
+        pac << file_index;
+        if (!packet || !CompressBlocksIntoPacket(files[file_index], block_indices, pac))
+          return 1;
+      }
+
+      SendChunked(std::move(pac), player.pid,
+                  fmt::format("GCI Folder {} Synchronization", is_slot_a ? 'A' : 'B'));
+    }
+    break;
+
     case SyncSaveDataID::Failure:
     {
       m_dialog->AppendChat(Common::FmtFormatT("{0} failed to synchronize.", player.name));
       m_dialog->OnGameStartAborted();
       ChunkedDataAbort();
       m_start_pending = false;
+      ClearSaveSyncData();
     }
     break;
 
@@ -1477,6 +1572,7 @@ bool NetPlayServer::SetupNetSettings()
   settings.strict_settings_sync = Config::Get(Config::NETPLAY_STRICT_SETTINGS_SYNC);
   settings.sync_codes = Config::Get(Config::NETPLAY_SYNC_CODES);
   settings.golf_mode = Config::Get(Config::NETPLAY_NETWORK_MODE) == "golf";
+  settings.rollback = Config::Get(Config::NETPLAY_NETWORK_MODE) == "rollback";
   settings.use_fma = DoAllPlayersHaveHardwareFMA();
   settings.hide_remote_gbas = Config::Get(Config::NETPLAY_HIDE_REMOTE_GBAS);
 
@@ -1685,6 +1781,7 @@ bool NetPlayServer::StartGame()
   spac << m_settings.sync_codes;
 
   spac << m_settings.golf_mode;
+  spac << m_settings.rollback;
   spac << m_settings.use_fma;
   spac << m_settings.hide_remote_gbas;
 
@@ -1707,6 +1804,7 @@ void NetPlayServer::AbortGameStart()
     m_dialog->OnGameStartAborted();
     ChunkedDataAbort();
     m_start_pending = false;
+    ClearSaveSyncData();
   }
   else
   {
@@ -1714,6 +1812,16 @@ void NetPlayServer::AbortGameStart()
   }
 }
 
+void NetPlayServer::ClearSaveSyncData()
+{
+  std::lock_guard lkg(m_crit.game);
+  for (ExpansionInterface::Slot slot : ExpansionInterface::MEMCARD_SLOTS)
+  {
+    m_raw_memcard_sync_data[slot] = {};
+    m_gci_folder_sync_data[slot] = {};
+  }
+}
+
 // called from ---GUI--- thread
 std::optional<SaveSyncInfo> NetPlayServer::CollectSaveSyncInfo()
 {
@@ -1858,18 +1966,33 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
 
       sf::Packet pac;
       pac << MessageID::SyncSaveData;
-      pac << SyncSaveDataID::RawData;
-      pac << is_slot_a << region << size_override;
 
       if (File::Exists(path))
       {
-        INFO_LOG_FMT(NETPLAY, "Sending data of raw memcard {} in slot {}.", path,
-                     is_slot_a ? 'A' : 'B');
-        if (!CompressFileIntoPacket(path, pac))
+        // Only send the hashes for now. Clients request the blocks they're missing afterwards.
+        std::string data;
+        if (!File::ReadFileToString(path, data))
           return false;
+
+        INFO_LOG_FMT(NETPLAY, "Sending block hashes of raw memcard {} in slot {}.", path,
+                     is_slot_a ? 'A' : 'B');
+        const std::vector<u64> hashes =
+            ComputeBlockHashes(std::span(reinterpret_cast<const u8*>(data.data()), data.size()));
+
+        pac << SyncSaveDataID::RawDataHashes;
+        pac << is_slot_a << region << size_override;
+        pac << static_cast<u64>(data.size());
+        for (const u64 hash : hashes)
+          pac << hash;
+
+        std::lock_guard lkg(m_crit.game);
+        m_raw_memcard_sync_data[slot] = std::vector<u8>(data.begin(), data.end());
       }
       else
       {
+        pac << SyncSaveDataID::RawData;
+        pac << is_slot_a << region << size_override;
+
         // No file, so we'll say the size is 0
         INFO_LOG_FMT(NETPLAY, "Sending empty marker for raw memcard {} in slot {}.", path,
                      is_slot_a ? 'A' : 'B');
@@ -1886,34 +2009,52 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
 
       sf::Packet pac;
       pac << MessageID::SyncSaveData;
-      pac << SyncSaveDataID::GCIData;
-      pac << is_slot_a;
 
+      std::vector<std::string> files;
       if (File::IsDirectory(path))
       {
-        std::vector<std::string> files =
+        files =
             GCMemcardDirectory::GetFileNamesForGameID(path + DIR_SEP, sync_info.game->GetGameID());
+      }
 
-        INFO_LOG_FMT(NETPLAY, "Sending data of GCI memcard {} in slot {} ({} files).", path,
+      if (!files.empty())
+      {
+        // Like for raw memcards, only send the hashes of each file for now.
+        INFO_LOG_FMT(NETPLAY, "Sending block hashes of GCI memcard {} in slot {} ({} files).", path,
                      is_slot_a ? 'A' : 'B', files.size());
 
-        pac << static_cast<u8>(files.size());
+        pac << SyncSaveDataID::GCIDataHashes;
+        pac << is_slot_a << static_cast<u8>(files.size());
 
+        std::vector<std::vector<u8>> contents;
         for (const std::string& file : files)
         {
           const std::string filename = file.substr(file.find_last_of('/') + 1);
-          INFO_LOG_FMT(NETPLAY, "Sending GCI {}.", filename);
-          pac << filename;
-          if (!CompressFileIntoPacket(file, pac))
+          std::string data;
+          if (!File::ReadFileToString(file, data))
             return false;
+
+          INFO_LOG_FMT(NETPLAY, "Sending block hashes of GCI {}.", filename);
+          pac << filename << static_cast<u64>(data.size());
+          for (const u64 hash :
+               ComputeBlockHashes(std::span(reinterpret_cast<const u8*>(data.data()), data.size())))
+          {
+            pac << hash;
+          }
+
+          contents.emplace_back(data.begin(), data.end());
         }
+
+        std::lock_guard lkg(m_crit.game);
+        m_gci_folder_sync_data[slot] = std::move(contents);
       }
       else
       {
         INFO_LOG_FMT(NETPLAY, "Sending empty marker for GCI memcard {} in slot {}.", path,
                      is_slot_a ? 'A' : 'B');
 
-        pac << static_cast<u8>(0);
+        pac << SyncSaveDataID::GCIData;
+        pac << is_slot_a << static_cast<u8>(0);
       }
 
       SendChunkedToClients(std::move(pac), 1,
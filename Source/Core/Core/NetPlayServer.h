@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "Common/Event.h"
 #include "Common/QoSSession.h"
@@ -120,6 +121,7 @@ private:
   bool SetupNetSettings();
   std::optional<SaveSyncInfo> CollectSaveSyncInfo();
   bool SyncSaveData(const SaveSyncInfo& sync_info);
+  void ClearSaveSyncData();
   bool SyncCodes();
   void CheckSyncAndStartGame();
 
@@ -176,6 +178,11 @@ private:
   bool m_codes_synced = true;
   bool m_start_pending = false;
   bool m_host_input_authority = false;
+  // Contents of the memory cards being synchronized, to answer the clients' block requests.
+  // Cleared once every client has its copy.
+  Common::EnumMap<std::vector<u8>, ExpansionInterface::MAX_MEMCARD_SLOT> m_raw_memcard_sync_data;
+  Common::EnumMap<std::vector<std::vector<u8>>, ExpansionInterface::MAX_MEMCARD_SLOT>
+      m_gci_folder_sync_data;
   PlayerId m_current_golfer = 1;
   PlayerId m_pending_golfer = 0;
 
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <functional>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -143,6 +144,49 @@ static double StreqFunc(expr_func* f, vec_expr_t* args, void* c)
   return strs[0] == strs[1];
 }
 
+template <typename T, typename U = T>
+static double CompiledHostRead(const Core::CPUThreadGuard& guard, u32 address)
+{
+  return std::bit_cast<T>(HostRead<U>(guard, address));
+}
+
+template <typename T, typename U = T>
+static double CompiledCast(double value)
+{
+  return std::bit_cast<T>(static_cast<U>(value));
+}
+
+using CompiledReadFunction = double (*)(const Core::CPUThreadGuard&, u32);
+using CompiledCastFunction = double (*)(double);
+
+static constexpr auto s_compiled_reads = std::to_array<std::pair<exprfn_t, CompiledReadFunction>>({
+    {HostReadFunc<u8>, CompiledHostRead<u8>},
+    {HostReadFunc<s8, u8>, CompiledHostRead<s8, u8>},
+    {HostReadFunc<u16>, CompiledHostRead<u16>},
+    {HostReadFunc<s16, u16>, CompiledHostRead<s16, u16>},
+    {HostReadFunc<u32>, CompiledHostRead<u32>},
+    {HostReadFunc<s32, u32>, CompiledHostRead<s32, u32>},
+    {HostReadFunc<float, u32>, CompiledHostRead<float, u32>},
+    {HostReadFunc<double, u64>, CompiledHostRead<double, u64>},
+});
+
+static constexpr auto s_compiled_casts = std::to_array<std::pair<exprfn_t, CompiledCastFunction>>({
+    {CastFunc<u8>, CompiledCast<u8>},
+    {CastFunc<s8, u8>, CompiledCast<s8, u8>},
+    {CastFunc<u16>, CompiledCast<u16>},
+    {CastFunc<s16, u16>, CompiledCast<s16, u16>},
+    {CastFunc<u32>, CompiledCast<u32>},
+    {CastFunc<s32, u32>, CompiledCast<s32, u32>},
+});
+
+// Returns nullptr if the function has no compiled form.
+template <typename Table>
+static auto FindCompiledFunction(const Table& table, exprfn_t function)
+{
+  const auto it = std::ranges::find(table, function, [](const auto& entry) { return entry.first; });
+  return it != table.end() ? it->second : nullptr;
+}
+
 static std::array<expr_func, 23> g_expr_funcs{{
     // For internal storage and comparisons, everything is auto-converted to Double.
     // If u64 ints are added, this could produce incorrect results.
@@ -353,6 +397,8 @@ Expression::Expression(std::string_view text, ExprPointer ex, ExprVarListPointer
     else
       m_binds.emplace_back();
   }
+
+  Compile();
 }
 
 std::optional<Expression> Expression::TryParse(std::string_view text)
@@ -365,11 +411,343 @@ std::optional<Expression> Expression::TryParse(std::string_view text)
   return Expression{text, std::move(ex), std::move(vars)};
 }
 
+static void ForEachAssignedVariable(expr* node, const std::function<void(double*)>& f)
+{
+  vec_expr_t* args;
+  switch (node->type)
+  {
+  case OP_CONST:
+  case OP_VAR:
+  case OP_STRING:
+    return;
+  case OP_FUNC:
+    args = &node->param.func.args;
+    break;
+  case OP_ASSIGN:
+    f(vec_nth(&node->param.op.args, 0).param.var.value);
+    [[fallthrough]];
+  default:
+    args = &node->param.op.args;
+    break;
+  }
+
+  for (int i = 0; i < vec_len(args); ++i)
+    ForEachAssignedVariable(&vec_nth(args, i), f);
+}
+
+void Expression::Compile()
+{
+  ForEachAssignedVariable(m_expr.get(), [this](double* value) {
+    if (VarBinding* bind = FindBinding(value))
+      bind->assigned = true;
+  });
+
+  CompileNode(m_expr.get(), 0);
+}
+
+Expression::VarBinding* Expression::FindBinding(const double* value)
+{
+  auto bind = m_binds.begin();
+  for (auto* v = m_vars->head; v != nullptr; v = v->next, ++bind)
+  {
+    if (&v->value == value)
+      return &*bind;
+  }
+  return nullptr;
+}
+
+u32 Expression::Emit(const Instruction& instruction)
+{
+  m_program.push_back(instruction);
+  return static_cast<u32>(m_program.size() - 1);
+}
+
+// The result of the node ends up in register dst. Registers above dst may be used as temporaries.
+// The evaluation order and results match expr_eval exactly.
+void Expression::CompileNode(expr* node, u16 dst)
+{
+  if (m_registers.size() <= dst)
+    m_registers.resize(dst + 1);
+
+  const auto arg = [node](int i) { return &vec_nth(&node->param.op.args, i); };
+  const auto emit_unary = [&](OpCode op) {
+    CompileNode(arg(0), dst);
+    Emit({.op = op, .dst = dst, .a = dst});
+  };
+  const auto emit_binary = [&](OpCode op) {
+    CompileNode(arg(0), dst);
+    CompileNode(arg(1), dst + 1);
+    Emit({.op = op, .dst = dst, .a = dst, .b = static_cast<u16>(dst + 1)});
+  };
+  const auto emit_const = [&](double value) {
+    Instruction instruction{.op = OpCode::Const, .dst = dst};
+    instruction.constant = value;
+    return Emit(instruction);
+  };
+
+  switch (node->type)
+  {
+  case OP_UNARY_MINUS:
+    emit_unary(OpCode::Negate);
+    break;
+  case OP_UNARY_LOGICAL_NOT:
+    emit_unary(OpCode::LogicalNot);
+    break;
+  case OP_UNARY_BITWISE_NOT:
+    emit_unary(OpCode::BitwiseNot);
+    break;
+  case OP_POWER:
+    emit_binary(OpCode::Power);
+    break;
+  case OP_MULTIPLY:
+    emit_binary(OpCode::Multiply);
+    break;
+  case OP_DIVIDE:
+    emit_binary(OpCode::Divide);
+    break;
+  case OP_REMAINDER:
+    emit_binary(OpCode::Remainder);
+    break;
+  case OP_PLUS:
+    emit_binary(OpCode::Add);
+    break;
+  case OP_MINUS:
+    emit_binary(OpCode::Subtract);
+    break;
+  case OP_SHL:
+    emit_binary(OpCode::ShiftLeft);
+    break;
+  case OP_SHR:
+    emit_binary(OpCode::ShiftRight);
+    break;
+  case OP_LT:
+    emit_binary(OpCode::Less);
+    break;
+  case OP_LE:
+    emit_binary(OpCode::LessEqual);
+    break;
+  case OP_GT:
+    emit_binary(OpCode::Greater);
+    break;
+  case OP_GE:
+    emit_binary(OpCode::GreaterEqual);
+    break;
+  case OP_EQ:
+    emit_binary(OpCode::Equal);
+    break;
+  case OP_NE:
+    emit_binary(OpCode::NotEqual);
+    break;
+  case OP_BITWISE_AND:
+    emit_binary(OpCode::BitwiseAnd);
+    break;
+  case OP_BITWISE_OR:
+    emit_binary(OpCode::BitwiseOr);
+    break;
+  case OP_BITWISE_XOR:
+    emit_binary(OpCode::BitwiseXor);
+    break;
+  case OP_LOGICAL_AND:
+  {
+    // a && b evaluates to b if both are non-zero, and to 0 otherwise.
+    CompileNode(arg(0), dst);
+    const u32 first_jump = Emit({.op = OpCode::JumpIfZero, .a = dst});
+    CompileNode(arg(1), dst);
+    const u32 second_jump = Emit({.op = OpCode::JumpIfZero, .a = dst});
+    const u32 end_jump = Emit({.op = OpCode::Jump});
+    const u32 false_label = emit_const(0);
+    m_program[first_jump].target = false_label;
+    m_program[second_jump].target = false_label;
+    m_program[end_jump].target = static_cast<u32>(m_program.size());
+    break;
+  }
+  case OP_LOGICAL_OR:
+  {
+    // a || b evaluates to a if it's non-zero and not NaN, else to b if it's non-zero, else to 0.
+    CompileNode(arg(0), dst);
+    const u32 first_jump = Emit({.op = OpCode::JumpIfNonZeroNotNaN, .a = dst});
+    CompileNode(arg(1), dst);
+    const u32 second_jump = Emit({.op = OpCode::JumpIfNonZero, .a = dst});
+    emit_const(0);
+    m_program[first_jump].target = static_cast<u32>(m_program.size());
+    m_program[second_jump].target = static_cast<u32>(m_program.size());
+    break;
+  }
+  case OP_ASSIGN:
+  {
+    CompileNode(arg(1), dst);
+    Instruction instruction{.op = OpCode::Store, .a = dst};
+    instruction.var = arg(0)->param.var.value;
+    Emit(instruction);
+    break;
+  }
+  case OP_COMMA:
+    CompileNode(arg(0), dst);
+    CompileNode(arg(1), dst);
+    break;
+  case OP_CONST:
+    emit_const(node->param.num.value);
+    break;
+  case OP_VAR:
+  {
+    Instruction instruction{.op = OpCode::Load, .dst = dst};
+    instruction.var = node->param.var.value;
+    Emit(instruction);
+    break;
+  }
+  case OP_FUNC:
+  {
+    const exprfn_t function = node->param.func.f->f;
+    vec_expr_t* args = &node->param.func.args;
+    if (vec_len(args) == 1)
+    {
+      if (const ReadFunction read = FindCompiledFunction(s_compiled_reads, function))
+      {
+        CompileNode(&vec_nth(args, 0), dst);
+        Instruction instruction{.op = OpCode::Read, .dst = dst, .a = dst};
+        instruction.read = read;
+        Emit(instruction);
+        break;
+      }
+
+      if (const CastFunction cast = FindCompiledFunction(s_compiled_casts, function))
+      {
+        CompileNode(&vec_nth(args, 0), dst);
+        Instruction instruction{.op = OpCode::Cast, .dst = dst, .a = dst};
+        instruction.cast = cast;
+        Emit(instruction);
+        break;
+      }
+    }
+
+    Instruction instruction{.op = OpCode::Call, .dst = dst};
+    instruction.call = node;
+    Emit(instruction);
+    break;
+  }
+  default:
+    emit_const(NAN);
+    break;
+  }
+}
+
+double Expression::Execute(Core::System& system) const
+{
+  std::optional<Core::CPUThreadGuard> guard;
+  double* const r = m_registers.data();
+
+  size_t pc = 0;
+  while (pc < m_program.size())
+  {
+    const Instruction& inst = m_program[pc++];
+    switch (inst.op)
+    {
+    case OpCode::Const:
+      r[inst.dst] = inst.constant;
+      break;
+    case OpCode::Load:
+      r[inst.dst] = *inst.var;
+      break;
+    case OpCode::Store:
+      *inst.var = r[inst.a];
+      break;
+    case OpCode::Negate:
+      r[inst.dst] = -r[inst.a];
+      break;
+    case OpCode::LogicalNot:
+      r[inst.dst] = !r[inst.a];
+      break;
+    case OpCode::BitwiseNot:
+      r[inst.dst] = ~to_int(r[inst.a]);
+      break;
+    case OpCode::Power:
+      r[inst.dst] = std::pow(r[inst.a], r[inst.b]);
+      break;
+    case OpCode::Multiply:
+      r[inst.dst] = r[inst.a] * r[inst.b];
+      break;
+    case OpCode::Divide:
+      r[inst.dst] = r[inst.a] / r[inst.b];
+      break;
+    case OpCode::Remainder:
+      r[inst.dst] = std::fmod(r[inst.a], r[inst.b]);
+      break;
+    case OpCode::Add:
+      r[inst.dst] = r[inst.a] + r[inst.b];
+      break;
+    case OpCode::Subtract:
+      r[inst.dst] = r[inst.a] - r[inst.b];
+      break;
+    case OpCode::ShiftLeft:
+      r[inst.dst] = to_int(r[inst.a]) << to_int(r[inst.b]);
+      break;
+    case OpCode::ShiftRight:
+      r[inst.dst] = to_int(r[inst.a]) >> to_int(r[inst.b]);
+      break;
+    case OpCode::Less:
+      r[inst.dst] = r[inst.a] < r[inst.b];
+      break;
+    case OpCode::LessEqual:
+      r[inst.dst] = r[inst.a] <= r[inst.b];
+      break;
+    case OpCode::Greater:
+      r[inst.dst] = r[inst.a] > r[inst.b];
+      break;
+    case OpCode::GreaterEqual:
+      r[inst.dst] = r[inst.a] >= r[inst.b];
+      break;
+    case OpCode::Equal:
+      r[inst.dst] = r[inst.a] == r[inst.b];
+      break;
+    case OpCode::NotEqual:
+      r[inst.dst] = r[inst.a] != r[inst.b];
+      break;
+    case OpCode::BitwiseAnd:
+      r[inst.dst] = to_int(r[inst.a]) & to_int(r[inst.b]);
+      break;
+    case OpCode::BitwiseOr:
+      r[inst.dst] = to_int(r[inst.a]) | to_int(r[inst.b]);
+      break;
+    case OpCode::BitwiseXor:
+      r[inst.dst] = to_int(r[inst.a]) ^ to_int(r[inst.b]);
+      break;
+    case OpCode::Jump:
+      pc = inst.target;
+      break;
+    case OpCode::JumpIfZero:
+      if (r[inst.a] == 0)
+        pc = inst.target;
+      break;
+    case OpCode::JumpIfNonZero:
+      if (r[inst.a] != 0)
+        pc = inst.target;
+      break;
+    case OpCode::JumpIfNonZeroNotNaN:
+      if (r[inst.a] != 0 && !std::isnan(r[inst.a]))
+        pc = inst.target;
+      break;
+    case OpCode::Read:
+      if (!guard)
+        guard.emplace(system);
+      r[inst.dst] = inst.read(*guard, static_cast<u32>(r[inst.a]));
+      break;
+    case OpCode::Cast:
+      r[inst.dst] = inst.cast(r[inst.a]);
+      break;
+    case OpCode::Call:
+      r[inst.dst] = expr_eval(inst.call);
+      break;
+    }
+  }
+
+  return r[0];
+}
+
 double Expression::Evaluate(Core::System& system) const
 {
   SynchronizeBindings(system, SynchronizeDirection::From);
 
-  double result = expr_eval(m_expr.get());
+  double result = Execute(system);
 
   SynchronizeBindings(system, SynchronizeDirection::To);
 
@@ -384,6 +762,9 @@ void Expression::SynchronizeBindings(Core::System& system, SynchronizeDirection
   auto bind = m_binds.begin();
   for (auto* v = m_vars->head; v != nullptr; v = v->next, ++bind)
   {
+    if (dir == SynchronizeDirection::To && !bind->assigned)
+      continue;
+
     switch (bind->type)
     {
     case VarBindingType::Zero:
@@ -436,15 +817,19 @@ void Expression::SynchronizeBindings(Core::System& system, SynchronizeDirection
 void Expression::Reporting(const double result) const
 {
   bool is_nan = std::isnan(result);
-  std::string message;
-
   for (auto* v = m_vars->head; v != nullptr; v = v->next)
   {
     if (std::isnan(v->value))
       is_nan = true;
+  }
+
+  // Most evaluations of a condition in a hot loop are false, so don't format anything for them.
+  if (result == 0.0 && !is_nan)
+    return;
 
+  std::string message;
+  for (auto* v = m_vars->head; v != nullptr; v = v->next)
     fmt::format_to(std::back_inserter(message), "  {}={}", v->name, v->value);
-  }
 
   if (is_nan)
   {
@@ -452,8 +837,7 @@ void Expression::Reporting(const double result) const
     Core::DisplayMessage("Breakpoint condition has encountered a NaN.", 2000);
   }
 
-  if (result != 0.0 || is_nan)
-    NOTICE_LOG_FMT(MEMMAP, "Breakpoint condition returned: {}. Vars:{}", result, message);
+  NOTICE_LOG_FMT(MEMMAP, "Breakpoint condition returned: {}. Vars:{}", result, message);
 }
 
 std::string Expression::GetText() const
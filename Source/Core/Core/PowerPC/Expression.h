@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
 
 struct expr;
 struct expr_var_list;
@@ -76,10 +77,77 @@ private:
   {
     VarBindingType type = VarBindingType::Zero;
     int index = -1;
+    // Only variables that are assigned to have to be written back after evaluation.
+    bool assigned = false;
+  };
+
+  // The parsed expression is compiled once into a flat register-based program, so that evaluating
+  // a condition on every hit doesn't have to walk the expr AST recursively.
+  enum class OpCode : u8
+  {
+    Const,
+    Load,
+    Store,
+    Negate,
+    LogicalNot,
+    BitwiseNot,
+    Power,
+    Multiply,
+    Divide,
+    Remainder,
+    Add,
+    Subtract,
+    ShiftLeft,
+    ShiftRight,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+    BitwiseAnd,
+    BitwiseOr,
+    BitwiseXor,
+    Jump,
+    JumpIfZero,
+    JumpIfNonZero,
+    JumpIfNonZeroNotNaN,
+    Read,
+    Cast,
+    Call,
+  };
+
+  using ReadFunction = double (*)(const Core::CPUThreadGuard& guard, u32 address);
+  using CastFunction = double (*)(double value);
+
+  struct Instruction
+  {
+    OpCode op;
+    u16 dst = 0;
+    u16 a = 0;
+    u16 b = 0;
+    union
+    {
+      double constant;
+      // The value of a variable in m_vars.
+      double* var;
+      u32 target;
+      ReadFunction read;
+      CastFunction cast;
+      // Functions without a compiled form are evaluated by the expr library.
+      expr* call;
+    };
   };
 
   Expression(std::string_view text, ExprPointer ex, ExprVarListPointer vars);
 
+  void Compile();
+  void CompileNode(expr* node, u16 dst);
+  u32 Emit(const Instruction& instruction);
+  VarBinding* FindBinding(const double* value);
+
+  double Execute(Core::System& system) const;
+
   void SynchronizeBindings(Core::System& system, SynchronizeDirection dir) const;
   void Reporting(const double result) const;
 
@@ -90,6 +158,9 @@ private:
   ExprVarListPointer m_vars;
   std::vector<VarBinding> m_binds;
 
+  std::vector<Instruction> m_program;
+  mutable std::vector<double> m_registers;
+
   BitSet32 m_gprs_used;
   BitSet32 m_fprs_used;
   bool m_has_computed_registers_used = false;
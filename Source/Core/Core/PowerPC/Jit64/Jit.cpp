@@ -350,6 +350,7 @@ void Jit64::Shutdown()
 
 void Jit64::FallBackToInterpreter(UGeckoInstruction inst)
 {
+  FlushGatherPipePointer();
   FlushCarry();
   gpr.Flush(BitSet32(0xFFFFFFFF), RegCache::FlushMode::Full,
             RegCache::IgnoreDiscardedRegisters::Yes);
@@ -418,6 +419,7 @@ void Jit64::FallBackToInterpreter(UGeckoInstruction inst)
 
 void Jit64::HLEFunction(u32 hook_index)
 {
+  FlushGatherPipePointer();
   gpr.Flush();
   fpr.Flush();
   ABI_PushRegistersAndAdjustStack({}, 0);
@@ -457,6 +459,13 @@ bool Jit64::Cleanup()
 {
   bool did_something = false;
 
+  // Exits can be conditional, so the pending offset stays pending for the code that follows.
+  if (js.fifoPtrOffset > 0)
+  {
+    UpdateGatherPipePointer();
+    did_something = true;
+  }
+
   if (jo.optimizeGatherPipe && js.fifoBytesSinceCheck > 0)
   {
     MOV(64, R(RSCRATCH), PPCSTATE(gather_pipe_ptr));
@@ -912,12 +921,35 @@ bool Jit64::SetEmitterStateToFreeCodeRegion()
   return true;
 }
 
+// The stores that can write to the gather pipe without calling out of the block, which is what
+// allows them to leave the gather pipe pointer update pending.
+static bool IsDFormStore(UGeckoInstruction inst)
+{
+  switch (inst.OPCD)
+  {
+  case 36:  // stw
+  case 37:  // stwu
+  case 38:  // stb
+  case 39:  // stbu
+  case 44:  // sth
+  case 45:  // sthu
+  case 52:  // stfs
+  case 53:  // stfsu
+  case 54:  // stfd
+  case 55:  // stfdu
+    return true;
+  default:
+    return false;
+  }
+}
+
 bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
   js.firstFPInstructionFound = false;
   js.isLastInstruction = false;
   js.blockStart = em_address;
   js.fifoBytesSinceCheck = 0;
+  js.fifoPtrOffset = 0;
   js.mustCheckFifo = false;
   js.curBlock = b;
   js.numLoadStoreInst = 0;
@@ -934,6 +966,14 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     ABI_PopRegistersAndAdjustStack({}, 0);
   }
 
+  if (IsExecutionTraceEnabled())
+  {
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionPC(&Core::ExecutionTrace::RecordBlockEntry,
+                       &m_system.GetPowerPC().GetExecutionTrace(), js.blockStart);
+    ABI_PopRegistersAndAdjustStack({}, 0);
+  }
+
   // Conditionally add profiling code.
   if (IsProfilingEnabled())
     ABI_CallFunctionP(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
@@ -1011,6 +1051,11 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       js.isLastInstruction = true;
     }
 
+    // Stores to the gather pipe leave updating gather_pipe_ptr to whatever comes after them, so
+    // that a run of them only has to update it once.
+    if (!IsDFormStore(op.inst))
+      FlushGatherPipePointer();
+
     if (i != 0)
     {
       // Gather pipe writes using a non-immediate address are discovered by profiling.
@@ -1021,6 +1066,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       if (jo.optimizeGatherPipe &&
           (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_SIZE || js.mustCheckFifo))
       {
+        FlushGatherPipePointer();
         js.fifoBytesSinceCheck = 0;
         js.mustCheckFifo = false;
         BitSet32 registersInUse = CallerSavedRegistersInUse();
@@ -91,6 +91,7 @@ public:
 
   const CommonAsmRoutines* GetAsmRoutines() override { return &asm_routines; }
   const char* GetName() const override { return "JIT64"; }
+  bool SupportsExecutionTrace() const override { return true; }
   // Run!
   void Run() override;
   void SingleStep() override;
@@ -329,6 +329,7 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
 
   auto& js = m_jit.js;
   registersInUse[reg_value] = false;
+  RecordMemoryAccess(false, opAddress, offset, R(reg_value), registersInUse, flags);
   if (m_jit.jo.fastmem && !(flags & (SAFE_LOADSTORE_NO_FASTMEM | SAFE_LOADSTORE_NO_UPDATE_PC)) &&
       !force_slow_access)
   {
@@ -502,6 +503,13 @@ void EmuCodeBlock::SafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int acces
   // set the correct immediate format
   reg_value = FixImmediate(accessSize, reg_value);
 
+  RecordMemoryAccess(true, R(reg_addr), offset, reg_value, registersInUse, flags);
+
+  // The address might be in the gather pipe, or the slow path might call into it. Trampolines and
+  // the shared asm routines aren't part of the block being compiled, so they have nothing pending.
+  if (!(flags & (SAFE_LOADSTORE_FORCE_SLOW_ACCESS | SAFE_LOADSTORE_NO_UPDATE_PC)))
+    FlushGatherPipePointer();
+
   auto& js = m_jit.js;
   if (m_jit.jo.fastmem && !(flags & (SAFE_LOADSTORE_NO_FASTMEM | SAFE_LOADSTORE_NO_UPDATE_PC)) &&
       !force_slow_access)
@@ -623,16 +631,68 @@ void EmuCodeBlock::SafeWriteRegToReg(Gen::X64Reg reg_value, Gen::X64Reg reg_addr
   SafeWriteRegToReg(R(reg_value), reg_addr, accessSize, offset, registersInUse, flags);
 }
 
+void EmuCodeBlock::RecordMemoryAccess(bool store, const OpArg& opAddress, s32 offset,
+                                      const OpArg& value, BitSet32 registersInUse, int flags)
+{
+  // Trampolines repeat an access that has already been recorded, and the shared asm routines
+  // aren't part of any block, so only accesses emitted directly into blocks are recorded.
+  if (!m_jit.IsExecutionTraceRecordingMemoryAccesses() ||
+      (flags & (SAFE_LOADSTORE_FORCE_SLOW_ACCESS | SAFE_LOADSTORE_NO_UPDATE_PC)))
+  {
+    return;
+  }
+
+  // The address and the value to store may be in scratch registers that the caller doesn't
+  // consider in use, but they're still needed for the access itself.
+  if (opAddress.IsSimpleReg())
+    registersInUse[opAddress.GetSimpleReg()] = true;
+  if (value.IsSimpleReg())
+    registersInUse[value.GetSimpleReg()] = true;
+
+  ABI_PushRegistersAndAdjustStack(registersInUse, 0);
+  if (opAddress.IsImm())
+  {
+    MOV(32, R(ABI_PARAM2), Imm32(opAddress.Imm32() + offset));
+  }
+  else if (opAddress.IsSimpleReg())
+  {
+    LEA(32, ABI_PARAM2, MDisp(opAddress.GetSimpleReg(), offset));
+  }
+  else
+  {
+    MOV(32, R(ABI_PARAM2), opAddress);
+    if (offset)
+      ADD(32, R(ABI_PARAM2), Imm32(offset));
+  }
+  MOV(64, R(ABI_PARAM1), ImmPtr(&m_jit.m_system.GetPowerPC().GetExecutionTrace()));
+  ABI_CallFunction(store ? &Core::ExecutionTrace::RecordStore : &Core::ExecutionTrace::RecordLoad);
+  ABI_PopRegistersAndAdjustStack(registersInUse, 0);
+}
+
 bool EmuCodeBlock::WriteClobbersRegValue(int accessSize, bool swap)
 {
   return swap && !cpu_info.bMOVBE && accessSize > 8;
 }
 
+void EmuCodeBlock::UpdateGatherPipePointer()
+{
+  if (m_jit.js.fifoPtrOffset > 0)
+    ADD(64, PPCSTATE(gather_pipe_ptr), Imm32(m_jit.js.fifoPtrOffset));
+}
+
+void EmuCodeBlock::FlushGatherPipePointer()
+{
+  UpdateGatherPipePointer();
+  m_jit.js.fifoPtrOffset = 0;
+}
+
 bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
                                        BitSet32 registersInUse)
 {
   arg = FixImmediate(accessSize, arg);
 
+  RecordMemoryAccess(true, Imm32(address), 0, arg, registersInUse);
+
   // If we already know the address through constant folding, we can do some
   // fun tricks...
   if (m_jit.jo.optimizeGatherPipe && m_jit.m_mmu.IsOptimizableGatherPipeWrite(address))
@@ -646,16 +706,18 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
     if (!arg.IsSimpleReg(arg_reg))
       MOV(accessSize, R(arg_reg), arg);
 
-    // And store it in the gather pipe
+    // And store it in the gather pipe, after any bytes that haven't been added to the pointer yet
     MOV(64, R(RSCRATCH2), PPCSTATE(gather_pipe_ptr));
-    SwapAndStore(accessSize, MatR(RSCRATCH2), arg_reg);
-    ADD(64, R(RSCRATCH2), Imm8(accessSize >> 3));
-    MOV(64, PPCSTATE(gather_pipe_ptr), R(RSCRATCH2));
+    SwapAndStore(accessSize, MDisp(RSCRATCH2, m_jit.js.fifoPtrOffset), arg_reg);
 
+    m_jit.js.fifoPtrOffset += accessSize >> 3;
     m_jit.js.fifoBytesSinceCheck += accessSize >> 3;
     return false;
   }
-  else if (m_jit.jo.fastmem_arena && m_jit.m_mmu.IsOptimizableRAMAddress(address, accessSize))
+
+  FlushGatherPipePointer();
+
+  if (m_jit.jo.fastmem_arena && m_jit.m_mmu.IsOptimizableRAMAddress(address, accessSize))
   {
     WriteToConstRamAddress(accessSize, arg, address);
     return false;
@@ -105,6 +105,12 @@ public:
   bool WriteToConstAddress(int accessSize, Gen::OpArg arg, u32 address, BitSet32 registersInUse);
   void WriteToConstRamAddress(int accessSize, Gen::OpArg arg, u32 address, bool swap = true);
 
+  // Gather pipe writes to constant addresses don't store gather_pipe_ptr back themselves, so that
+  // consecutive ones only pay for one update. Update adds the pending bytes to the pointer, and
+  // Flush additionally marks them as done. Neither needs a register, but both clobber flags.
+  void UpdateGatherPipePointer();
+  void FlushGatherPipePointer();
+
   void JitGetAndClearCAOV(bool oe);
   void JitSetCA();
   void JitSetCAIf(Gen::CCFlags conditionCode);
@@ -122,6 +128,12 @@ public:
               void (Gen::XEmitter::*sseOp)(Gen::X64Reg, u8), Gen::X64Reg regOp1, Gen::X64Reg regOp2,
               u8 imm);
 
+  // Emits a call recording the effective address of a load or store in the execution trace, if the
+  // trace is recording memory accesses. Must be called before the access is emitted. value is the
+  // register loaded into or stored from.
+  void RecordMemoryAccess(bool store, const Gen::OpArg& opAddress, s32 offset,
+                          const Gen::OpArg& value, BitSet32 registersInUse, int flags = 0);
+
   void Force25BitPrecision(Gen::X64Reg output, const Gen::OpArg& input, Gen::X64Reg tmp);
 
   // RSCRATCH might get trashed
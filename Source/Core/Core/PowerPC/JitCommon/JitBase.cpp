@@ -139,9 +139,10 @@ void JitBase::RefreshConfig()
   analyzer.SetFloatExceptionsEnabled(m_enable_float_exceptions);
   analyzer.SetDivByZeroExceptionsEnabled(m_enable_div_by_zero_exceptions);
 
+  // Watched pages are left out of (or protected in) the fastmem views, so accesses to them fault
+  // and get backpatched into slow accesses that check the memchecks.
   bool any_watchpoints = m_system.GetPowerPC().GetMemChecks().HasAny();
-  jo.fastmem = m_fastmem_enabled && jo.fastmem_arena && (m_ppc_state.msr.DR || !any_watchpoints) &&
-               EMM::IsExceptionHandlerSupported();
+  jo.fastmem = m_fastmem_enabled && jo.fastmem_arena && EMM::IsExceptionHandlerSupported();
   jo.memcheck = m_system.IsMMUMode() || m_system.IsPauseOnPanicMode() || any_watchpoints;
   jo.fp_exceptions = m_enable_float_exceptions;
   jo.div_by_zero_exceptions = m_enable_div_by_zero_exceptions;
@@ -119,6 +119,8 @@ protected:
 
     bool mustCheckFifo;
     u32 fifoBytesSinceCheck;
+    // Bytes written to the gather pipe that haven't been added to gather_pipe_ptr yet.
+    u32 fifoPtrOffset = 0;
 
     PPCAnalyst::BlockStats st;
     PPCAnalyst::BlockRegStats gpa;
@@ -207,6 +209,16 @@ public:
     auto& branch_watch = m_system.GetPowerPC().GetBranchWatch();
     return branch_watch.GetRecordingActive();
   }
+  // Only JITs that emit the records can record an execution trace.
+  virtual bool SupportsExecutionTrace() const { return false; }
+  bool IsExecutionTraceEnabled() const
+  {
+    return m_system.GetPowerPC().GetExecutionTrace().GetRecordingActive();
+  }
+  bool IsExecutionTraceRecordingMemoryAccesses() const
+  {
+    return m_system.GetPowerPC().GetExecutionTrace().GetRecordingMemoryAccesses();
+  }
 
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
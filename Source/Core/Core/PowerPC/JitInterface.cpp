@@ -87,6 +87,11 @@ bool JitInterface::WantsPageTableMappings() const
 }
 #endif
 
+bool JitInterface::SupportsExecutionTrace() const
+{
+  return m_jit && m_jit->SupportsExecutionTrace();
+}
+
 void JitInterface::UpdateMembase()
 {
   if (!m_jit)
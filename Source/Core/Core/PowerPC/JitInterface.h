@@ -51,6 +51,8 @@ public:
   bool WantsPageTableMappings() const;
 #endif
 
+  bool SupportsExecutionTrace() const;
+
   void UpdateMembase();
   void JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE* file) const;
   void WipeBlockProfilingData(const Core::CPUThreadGuard& guard);
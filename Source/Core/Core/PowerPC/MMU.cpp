@@ -953,6 +953,48 @@ bool MMU::HostIsInstructionRAMAddress(const Core::CPUThreadGuard& guard, u32 add
   return false;
 }
 
+const u8* MMU::HostGetPagePointer(const Core::CPUThreadGuard& guard, u32 page_address,
+                                  RequestedAddressSpace space)
+{
+  auto& mmu = guard.GetSystem().GetMMU();
+
+  // With the data cache emulated, RAM may not hold the latest values.
+  if (mmu.m_ppc_state.m_enable_dcache)
+    return nullptr;
+
+  bool translate = false;
+  switch (space)
+  {
+  case RequestedAddressSpace::Effective:
+    translate = mmu.m_ppc_state.msr.DR;
+    break;
+  case RequestedAddressSpace::Physical:
+    break;
+  case RequestedAddressSpace::Virtual:
+    if (!mmu.m_ppc_state.msr.DR)
+      return nullptr;
+    translate = true;
+    break;
+  }
+
+  u32 physical_address = page_address;
+  if (translate)
+  {
+    const auto translate_address = mmu.TranslateAddress<XCheckTLBFlag::NoException>(page_address);
+    if (!translate_address.Success())
+      return nullptr;
+    physical_address = translate_address.address;
+  }
+
+  const u32 segment = physical_address >> 28;
+  const u32 offset = physical_address & 0x0FFFFFFF;
+  if (mmu.m_memory.GetRAM() && segment == 0x0 && offset < mmu.m_memory.GetRamSizeReal())
+    return mmu.m_memory.GetRAM() + offset;
+  if (mmu.m_memory.GetEXRAM() && segment == 0x1 && offset < mmu.m_memory.GetExRamSizeReal())
+    return mmu.m_memory.GetEXRAM() + offset;
+  return nullptr;
+}
+
 void MMU::DMA_LCToMemory(const u32 mem_address, const u32 cache_address, const u32 num_blocks)
 {
   // TODO: It's not completely clear this is the right spot for this code;
@@ -2014,6 +2056,7 @@ void MMU::DBATUpdated()
 
 #ifndef _ARCH_32
   m_memory.UpdateDBATMappings(m_dbat_table);
+  m_memory.UpdatePhysicalMemCheckProtection(m_power_pc.GetMemChecks());
 
   // Calling UpdateDBATMappings removes all fastmem page table mappings, so we have to recreate
   // them. We need to go through them anyway because there may have been a change in which DBATs
@@ -221,6 +221,13 @@ public:
   HostIsInstructionRAMAddress(const Core::CPUThreadGuard& guard, u32 address,
                               RequestedAddressSpace space = RequestedAddressSpace::Effective);
 
+  // Returns the host memory backing the given page of MEM1 or MEM2 if it can be read directly, or
+  // nullptr if reads from the page have to go through the MMU. The pointer is only valid until the
+  // address translation or the data cache setting changes.
+  static const u8*
+  HostGetPagePointer(const Core::CPUThreadGuard& guard, u32 page_address,
+                     RequestedAddressSpace space = RequestedAddressSpace::Effective);
+
   // Routines for the CPU core to access memory.
 
   // Used by interpreter to read instructions, uses iCache
@@ -315,6 +315,7 @@ void PowerPCManager::Shutdown()
 {
   CPUThreadConfigCallback::RemoveConfigChangedCallback(m_registered_config_callback_id);
   InjectExternalCPUCore(nullptr);
+  m_execution_trace.Shutdown();
   m_system.GetJitInterface().Shutdown();
   m_system.GetInterpreter().Shutdown();
   m_cpu_core_base = nullptr;
@@ -14,6 +14,7 @@
 
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Debugger/BranchWatch.h"
+#include "Core/Debugger/ExecutionTrace.h"
 #include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/PowerPC/BreakPoints.h"
 #include "Core/PowerPC/ConditionRegister.h"
@@ -306,6 +307,8 @@ public:
   const PPCSymbolDB& GetSymbolDB() const { return m_symbol_db; }
   Core::BranchWatch& GetBranchWatch() { return m_branch_watch; }
   const Core::BranchWatch& GetBranchWatch() const { return m_branch_watch; }
+  Core::ExecutionTrace& GetExecutionTrace() { return m_execution_trace; }
+  const Core::ExecutionTrace& GetExecutionTrace() const { return m_execution_trace; }
 
 private:
   void InitializeCPUCore(CPUCore cpu_core);
@@ -324,6 +327,7 @@ private:
   PPCSymbolDB m_symbol_db;
   PPCDebugInterface m_debug_interface;
   Core::BranchWatch m_branch_watch;
+  Core::ExecutionTrace m_execution_trace;
 
   CPUThreadConfigCallback::ConfigChangedCallbackID m_registered_config_callback_id;
 
@@ -4,12 +4,18 @@
 #include "Core/State.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <filesystem>
+#include <functional>
 #include <locale>
 #include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <span>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -19,12 +25,15 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/Buffer.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Contains.h"
+#include "Common/Event.h"
 #include "Common/FileUtil.h"
+#include "Common/Flag.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
@@ -87,7 +96,9 @@ static Common::TransferableSharedMutex s_state_saves_in_progress;
 
 struct CompressAndDumpStateArgs
 {
+  // Only the first size bytes of the buffer contain the state.
   Common::UniqueBuffer<u8> buffer;
+  std::size_t size;
   std::string filename;
   std::shared_lock<decltype(s_state_saves_in_progress)> task_lock;
 };
@@ -96,6 +107,20 @@ struct CompressAndDumpStateArgs
 // Only the CPU thread manipulates this worker.
 static Common::WorkQueueThreadSP<CompressAndDumpStateArgs> s_compress_and_dump_thread;
 
+// The buffer of the most recently written state, which the next save reuses. Serializing into
+// memory that is already allocated and paged in makes the pause on the CPU thread much shorter
+// than with a fresh allocation, whose pages would all fault in during the copy of guest RAM.
+static std::mutex s_spare_save_buffer_mutex;
+static Common::UniqueBuffer<u8> s_spare_save_buffer;
+// Frees the spare buffer once no state has been saved for a while, since it is as large as guest
+// RAM. This is a host timer, as emulated time doesn't pass while paused, and a CoreTiming event
+// would end up in savestates and movies.
+static std::thread s_spare_save_buffer_release_thread;
+static Common::Flag s_spare_save_buffer_release_running;
+// Set whenever the worker stores a spare buffer, which restarts the timeout.
+static Common::Event s_spare_save_buffer_stored;
+constexpr std::chrono::seconds SPARE_SAVE_BUFFER_TIMEOUT{60};
+
 // Don't forget to increase this after doing changes on the savestate system
 constexpr u32 STATE_VERSION = 192;  // Last changed in PR 14646
 
@@ -125,6 +150,12 @@ static const std::map<u32, std::pair<std::string, std::string>> s_old_versions =
 
 static constexpr bool s_use_compression = true;
 
+// Compressed states are split into chunks of this size, which are compressed independently of
+// each other so that they can be compressed and decompressed on multiple threads.
+constexpr size_t STATE_CHUNK_SIZE = 4 * 1024 * 1024;
+constexpr int STATE_ZSTD_LEVEL = 3;
+constexpr u32 MAX_STATE_COMPRESSION_THREADS = 8;
+
 // Acquired for tasks that will write state save data to the filesystem.
 // This allows for later waiting on completion of said tasks when necessary.
 // We want to maintain a proper order of async operations, e.g. Save, Save, GetInfoString.
@@ -224,7 +255,7 @@ static bool CheckIfStateLoadIsAllowed(Core::System& system)
   return true;
 }
 
-static bool LoadFromBuffer(Core::System& system, std::span<u8> buffer)
+bool LoadFromBuffer(Core::System& system, std::span<u8> buffer)
 {
   u8* ptr = buffer.data();
   PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
@@ -233,7 +264,7 @@ static bool LoadFromBuffer(Core::System& system, std::span<u8> buffer)
 }
 
 // Returns the required size, or 0 on failure.
-static std::size_t SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+std::size_t SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
 {
   // Attempt to save to our provided buffer as-is.
   // If buffer isn't large enough, PointerWrap transitions to MeasureMode,
@@ -327,34 +358,68 @@ static std::vector<SlotWithTimestamp> GetUsedSlotsWithTimestamp()
   return result;
 }
 
-static void CompressBufferToFile(std::span<const u8> raw_buffer, File::IOFile& f)
+// Calls function for each index in [0, count) on up to MAX_STATE_COMPRESSION_THREADS threads.
+static void ForEachChunkInParallel(size_t count, const std::function<void(size_t)>& function)
 {
-  u64 total_bytes_compressed = 0;
-
-  while (true)
-  {
-    const u64 bytes_left_to_compress = raw_buffer.size() - total_bytes_compressed;
-
-    const int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    Common::UniqueBuffer<char> compressed_buffer(LZ4_compressBound(bytes_to_compress));
-    const int compressed_len = LZ4_compress_default(
-        reinterpret_cast<const char*>(raw_buffer.data()) + total_bytes_compressed,
-        compressed_buffer.get(), bytes_to_compress, static_cast<int>(compressed_buffer.size()));
+  std::atomic<size_t> next_index = 0;
+  const auto run = [&] {
+    for (size_t i = next_index++; i < count; i = next_index++)
+      function(i);
+  };
+
+  const u32 thread_count = static_cast<u32>(std::min<size_t>(
+      std::clamp(std::thread::hardware_concurrency(), 1u, MAX_STATE_COMPRESSION_THREADS), count));
+  std::vector<std::thread> threads;
+  for (u32 i = 1; i < thread_count; ++i)
+    threads.emplace_back(run);
+  run();
+  for (std::thread& thread : threads)
+    thread.join();
+}
 
-    if (compressed_len == 0)
+static void CompressBufferToFile(std::span<const u8> raw_buffer, File::IOFile& f)
+{
+  const size_t chunk_count = (raw_buffer.size() + STATE_CHUNK_SIZE - 1) / STATE_CHUNK_SIZE;
+  std::vector<StateChunkHeader> chunk_headers(chunk_count);
+  std::vector<Common::UniqueBuffer<u8>> compressed_chunks(chunk_count);
+
+  const auto get_chunk = [&](size_t i) {
+    const size_t offset = i * STATE_CHUNK_SIZE;
+    return raw_buffer.subspan(offset, std::min(STATE_CHUNK_SIZE, raw_buffer.size() - offset));
+  };
+
+  ForEachChunkInParallel(chunk_count, [&](size_t i) {
+    const std::span<const u8> chunk = get_chunk(i);
+    Common::UniqueBuffer<u8> compressed(ZSTD_compressBound(chunk.size()));
+    const size_t compressed_size = ZSTD_compress(compressed.data(), compressed.size(),
+                                                 chunk.data(), chunk.size(), STATE_ZSTD_LEVEL);
+
+    StateChunkHeader& header = chunk_headers[i];
+    header.uncompressed_size = static_cast<u32>(chunk.size());
+
+    // Chunks that don't get smaller (like already compressed data) are stored as they are.
+    if (ZSTD_isError(compressed_size) || compressed_size >= chunk.size())
     {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
+      header.codec = StateChunkCodec::Uncompressed;
+      header.compressed_size = chunk.size();
     }
+    else
+    {
+      header.codec = StateChunkCodec::Zstd;
+      header.compressed_size = compressed_size;
+      compressed_chunks[i].assign(compressed.extract().first, compressed_size);
+    }
+  });
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
-
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == raw_buffer.size())
-      break;
+  const u32 chunk_count_u32 = static_cast<u32>(chunk_count);
+  f.WriteArray(&chunk_count_u32, 1);
+  f.WriteArray(chunk_headers.data(), chunk_headers.size());
+  for (size_t i = 0; i < chunk_count; ++i)
+  {
+    if (chunk_headers[i].codec == StateChunkCodec::Zstd)
+      f.WriteBytes(compressed_chunks[i].data(), compressed_chunks[i].size());
+    else
+      f.WriteBytes(get_chunk(i).data(), get_chunk(i).size());
   }
 }
 
@@ -363,7 +428,7 @@ static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t un
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
   base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+      s_use_compression ? CompressionType::Chunked : CompressionType::Uncompressed;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
@@ -392,11 +457,9 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   // If StateExtendedHeader is amended to include more than the base, add WriteBytes() calls here.
 }
 
-static void CompressAndDumpState(Core::System& system, const CompressAndDumpStateArgs& save_args)
+static void WriteStateFile(Core::System& system, std::span<const u8> buffer,
+                           const std::string& filename)
 {
-  const auto& buffer = save_args.buffer;
-  const std::string& filename = save_args.filename;
-
   // Find free temporary filename.
 
   // TODO: The file exists check and the actual opening of the file should be atomic.
@@ -473,20 +536,61 @@ static void CompressAndDumpState(Core::System& system, const CompressAndDumpStat
   }
 }
 
+static void CompressAndDumpState(Core::System& system, CompressAndDumpStateArgs save_args)
+{
+  WriteStateFile(system, std::span(save_args.buffer.data(), save_args.size), save_args.filename);
+
+  {
+    std::lock_guard lk(s_spare_save_buffer_mutex);
+    s_spare_save_buffer = std::move(save_args.buffer);
+  }
+  s_spare_save_buffer_stored.Set();
+}
+
+static void SpareSaveBufferReleaseThread()
+{
+  Common::SetCurrentThreadName("Savestate Buffer Release");
+
+  while (s_spare_save_buffer_release_running.IsSet())
+  {
+    s_spare_save_buffer_stored.Wait();
+    while (s_spare_save_buffer_release_running.IsSet() &&
+           s_spare_save_buffer_stored.WaitFor(SPARE_SAVE_BUFFER_TIMEOUT))
+    {
+    }
+
+    std::lock_guard lk(s_spare_save_buffer_mutex);
+    s_spare_save_buffer.reset();
+  }
+}
+
+static Common::UniqueBuffer<u8> TakeSaveBuffer(std::size_t min_size)
+{
+  std::lock_guard lk(s_spare_save_buffer_mutex);
+  if (s_spare_save_buffer.size() >= min_size)
+    return std::move(s_spare_save_buffer);
+  s_spare_save_buffer.reset();
+  return Common::UniqueBuffer<u8>{min_size};
+}
+
+// The whole state, guest RAM included, is still serialized on the CPU thread, so saving pauses
+// the emulation for a copy of MEM1, MEM2 and ARAM. Snapshotting guest RAM copy-on-write and
+// serializing it on the worker would need write protection of the MemArena views, which conflicts
+// with the fault handling of fastmem. Reusing the buffer only avoids the page faults of a fresh
+// allocation during that copy.
 static void SaveAsFromCore(Core::System& system, std::string filename)
 {
   // Try with a buffer a bit larger than the previous state.
   // This will often avoid the "Measure" step.
   const auto buffer_size_estimate = static_cast<std::size_t>(s_last_state_size) * 110 / 100;
-  Common::UniqueBuffer<u8> buffer{buffer_size_estimate};
+  Common::UniqueBuffer<u8> buffer = TakeSaveBuffer(buffer_size_estimate);
 
   if (const auto actual_size = SaveToBuffer(system, buffer))
   {
-    // Adjust the oversized buffer down to the actual size.
-    buffer.assign(buffer.extract().first, actual_size);
-
+    // The oversized buffer is kept as is, so that it can be reused for the next save.
     CompressAndDumpStateArgs dump_args{
         .buffer = std::move(buffer),
+        .size = actual_size,
         .filename = std::move(filename),
         .task_lock = GetStateSaveTaskLock(),
     };
@@ -696,6 +800,102 @@ static bool DecompressLZ4(Common::UniqueBuffer<u8>& raw_buffer, u64 size, File::
   }
 }
 
+static bool DecompressChunks(Common::UniqueBuffer<u8>& raw_buffer, u64 size, File::IOFile& f)
+{
+  u32 chunk_count = 0;
+  if (!f.ReadArray(&chunk_count, 1))
+  {
+    PanicAlertFmt("Could not read state chunk count");
+    return false;
+  }
+
+  if (u64{chunk_count} * sizeof(StateChunkHeader) > f.GetSize() - f.Tell())
+  {
+    PanicAlertFmt("State chunk count corrupted ({0})", chunk_count);
+    return false;
+  }
+
+  std::vector<StateChunkHeader> chunk_headers(chunk_count);
+  if (!f.ReadArray(chunk_headers.data(), chunk_headers.size()))
+  {
+    PanicAlertFmt("Could not read state chunk headers");
+    return false;
+  }
+
+  // The index gives the location of every chunk, so they can be decompressed independently.
+  // Bounding each chunk also keeps the sums far from overflowing, as there are less than 2^32.
+  std::vector<u64> compressed_offsets(chunk_count);
+  std::vector<u64> uncompressed_offsets(chunk_count);
+  u64 compressed_size = 0;
+  u64 uncompressed_size = 0;
+  for (u32 i = 0; i < chunk_count; ++i)
+  {
+    const StateChunkHeader& header = chunk_headers[i];
+    if (header.uncompressed_size > STATE_CHUNK_SIZE ||
+        header.compressed_size > ZSTD_compressBound(header.uncompressed_size))
+    {
+      PanicAlertFmt("State chunk {0} corrupted ({1} / {2})", i, header.compressed_size,
+                    header.uncompressed_size);
+      return false;
+    }
+
+    compressed_offsets[i] = compressed_size;
+    uncompressed_offsets[i] = uncompressed_size;
+    compressed_size += header.compressed_size;
+    uncompressed_size += header.uncompressed_size;
+  }
+
+  if (uncompressed_size != size || compressed_size > f.GetSize() - f.Tell())
+  {
+    PanicAlertFmt("State chunk sizes corrupted ({0} / {1})", uncompressed_size, size);
+    return false;
+  }
+
+  Common::UniqueBuffer<u8> compressed_data(compressed_size);
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.reset(size);
+
+  std::atomic<bool> success = true;
+  ForEachChunkInParallel(chunk_count, [&](size_t i) {
+    const StateChunkHeader& header = chunk_headers[i];
+    const u8* const src = compressed_data.data() + compressed_offsets[i];
+    u8* const dst = raw_buffer.data() + uncompressed_offsets[i];
+
+    switch (header.codec)
+    {
+    case StateChunkCodec::Uncompressed:
+      if (header.compressed_size != header.uncompressed_size)
+        success = false;
+      else
+        std::memcpy(dst, src, header.uncompressed_size);
+      break;
+    case StateChunkCodec::Zstd:
+      if (ZSTD_decompress(dst, header.uncompressed_size, src, header.compressed_size) !=
+          header.uncompressed_size)
+      {
+        success = false;
+      }
+      break;
+    default:
+      success = false;
+      break;
+    }
+  });
+
+  if (!success)
+  {
+    PanicAlertFmt("Internal zstd Error - state decompression failed");
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -778,6 +978,14 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
 
     break;
   }
+  case CompressionType::Chunked:
+  {
+    Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
+    if (!DecompressChunks(buffer, extended_header.base_header.uncompressed_size, f))
+      return;
+
+    break;
+  }
   case CompressionType::Uncompressed:
   {
     u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
@@ -894,6 +1102,8 @@ void Init(Core::System& system)
 #endif
   s_compress_and_dump_thread.Reset("Savestate Worker",
                                    std::bind_front(&CompressAndDumpState, std::ref(system)));
+  s_spare_save_buffer_release_running.Set();
+  s_spare_save_buffer_release_thread = std::thread(SpareSaveBufferReleaseThread);
 
   s_flush_unsaved_data_hook = UICommon::AddFlushUnsavedDataCallback([] {
     // Holding the lock for any amount of time means there are no pending state save tasks.
@@ -904,6 +1114,13 @@ void Init(Core::System& system)
 void Shutdown()
 {
   s_compress_and_dump_thread.Shutdown();
+  if (s_spare_save_buffer_release_thread.joinable())
+  {
+    s_spare_save_buffer_release_running.Clear();
+    s_spare_save_buffer_stored.Set();
+    s_spare_save_buffer_release_thread.join();
+  }
+  s_spare_save_buffer.reset();
   s_undo_load_buffer.reset();
   s_flush_unsaved_data_hook.reset();
 }
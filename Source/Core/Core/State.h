@@ -7,9 +7,11 @@
 
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <string>
 #include <type_traits>
 
+#include "Common/Buffer.h"
 #include "Common/CommonTypes.h"
 #ifdef __LIBRETRO__
 #include "Common/ChunkFile.h"
@@ -57,10 +59,28 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // The payload is a u32 chunk count, a StateChunkHeader for each chunk, and then the data of
+  // each chunk. Chunks are compressed independently of each other.
+  Chunked = 2,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
 
+enum class StateChunkCodec : u32
+{
+  Uncompressed = 0,
+  Zstd = 1,
+};
+
+struct StateChunkHeader
+{
+  StateChunkCodec codec;
+  u32 uncompressed_size;
+  u64 compressed_size;
+};
+static_assert(sizeof(StateChunkHeader) == 16);
+static_assert(std::is_trivially_copyable_v<StateChunkHeader>);
+
 struct StateExtendedBaseHeader
 {
   u16 header_version;
@@ -106,6 +126,12 @@ void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
 void UndoLoadState(Core::System& system);
 
+// Saves or loads an uncompressed state in memory, without any header. These must be called from
+// the CPU thread while the emulation is paused there, e.g. from a CPU-thread callback.
+// SaveToBuffer grows the buffer if needed and returns the size of the state, or 0 on failure.
+std::size_t SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
+bool LoadFromBuffer(Core::System& system, std::span<u8> buffer);
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
@@ -33,6 +33,7 @@
 #include "IOS/USB/Emulated/Infinity.h"
 #include "IOS/USB/Emulated/Skylanders/Skylander.h"
 #include "IOS/USB/USBScanner.h"
+#include "VideoCommon/AsyncRequests.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/GeometryShaderManager.h"
@@ -64,6 +65,8 @@ struct System::Impl
   // Built first since other constructors may register hooks right away.
   VideoEvents m_video_events;
 
+  AsyncRequests m_async_requests;
+
   std::unique_ptr<SoundStream> m_sound_stream;
   bool m_sound_stream_running = false;
   bool m_audio_dump_started = false;
@@ -114,6 +117,11 @@ System::System() : m_impl{std::make_unique<Impl>(*this)}
 
 System::~System() = default;
 
+std::unique_ptr<System> System::CreateInstance()
+{
+  return std::unique_ptr<System>(new System());
+}
+
 void System::Initialize()
 {
   m_separate_cpu_and_gpu_threads = Config::Get(Config::MAIN_CPU_THREAD);
@@ -162,6 +170,11 @@ void System::SetIOS(std::unique_ptr<IOS::HLE::EmulationKernel> ios)
   m_impl->m_ios = std::move(ios);
 }
 
+AsyncRequests& System::GetAsyncRequests() const
+{
+  return m_impl->m_async_requests;
+}
+
 AudioInterface::AudioInterfaceManager& System::GetAudioInterface() const
 {
   return m_impl->m_audio_interface;
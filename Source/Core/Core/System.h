@@ -7,6 +7,7 @@
 
 #include "Common/CommonTypes.h"
 
+class AsyncRequests;
 class GeometryShaderManager;
 class Interpreter;
 class JitInterface;
@@ -140,6 +141,11 @@ public:
     return instance;
   }
 
+  // Creates an instance that is independent from the one returned by GetInstance(). Code that
+  // still goes through GetInstance() always reaches the latter, so additional instances can only
+  // be driven through explicit references for now, and can't boot a game.
+  static std::unique_ptr<System> CreateInstance();
+
   void Initialize();
 
   bool IsDualCoreMode() const { return m_separate_cpu_and_gpu_threads; }
@@ -166,6 +172,7 @@ public:
   IOS::HLE::EmulationKernel* GetIOS() const;
   void SetIOS(std::unique_ptr<IOS::HLE::EmulationKernel> ios);
 
+  AsyncRequests& GetAsyncRequests() const;
   AudioInterface::AudioInterfaceManager& GetAudioInterface() const;
   CPU::CPUManager& GetCPU() const;
   CoreTiming::CoreTimingManager& GetCoreTiming() const;
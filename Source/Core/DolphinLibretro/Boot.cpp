@@ -48,6 +48,7 @@ namespace fs = std::filesystem;
 namespace Libretro
 {
 extern retro_environment_t environ_cb;
+extern void JoinPipelinedFrame();
 
 // Disk swapping
 static void InitDiskControlInterface();
@@ -386,6 +387,8 @@ bool retro_load_game(const struct retro_game_info* game)
   // Main.DSP
   Config::SetBase(Config::MAIN_DSP_JIT,
                      Libretro::GetOption<bool>(audio::DSP_JIT, /*def=*/true));
+  Config::SetBase(Config::MAIN_DSP_HLE_THREAD,
+                     Libretro::GetOption<bool>(audio::DSP_HLE_THREAD, /*def=*/false));
   Config::SetBase(Config::MAIN_DUMP_AUDIO, false);
 
   Config::SetBase(Config::MAIN_AUDIO_BACKEND, BACKEND_LIBRETRO);
@@ -759,6 +762,7 @@ void retro_unload_game(void)
 
   if (Core::IsRunning(system))
   {
+    Libretro::JoinPipelinedFrame();
     Core::Stop(system);
 #if defined(__LIBUSB__)
     system.ShutdownUSBScanner();
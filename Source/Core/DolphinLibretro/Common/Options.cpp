@@ -169,6 +169,21 @@ static struct retro_core_option_v2_definition option_defs[] = {
     },
     "enabled"
   },
+  {
+    Libretro::Options::core::FRAME_PIPELINE_LATENCY,
+    "Core > Pipelined Frame Latency",
+    "Pipelined Frame Latency",
+    "Dual core only. With 1 frame, the emulated CPU starts the next frame while the frontend presents the current one, "
+    "improving throughput at the cost of one frame of input latency.",
+    nullptr,
+    CATEGORY_CORE,
+    {
+      { "0", "0 Frames (Default)" },
+      { "1", "1 Frame" },
+      { nullptr, nullptr }
+    },
+    "0"
+  },
   {
     Libretro::Options::core::MAIN_PRECISION_FRAME_TIMING,
     "Core > Precision Frame Timing",
@@ -570,6 +585,22 @@ static struct retro_core_option_v2_definition option_defs[] = {
     },
     "enabled"
   },
+  {
+    Libretro::Options::audio::DSP_HLE_THREAD,
+    "Audio / DSP > DSP HLE Thread",
+    "DSP HLE Thread",
+    "Run DSP HLE audio mixing on a separate thread.",
+    "DSP HLE only. Mixes audio on a separate thread while the emulated CPU keeps running, which "
+    "helps on CPU-bound games. Only used on hosts with enough cores for a DSP thread, and ignored "
+    "during netplay and movie recording or playback. Requires core RESTART.",
+    CATEGORY_AUDIO,
+    {
+      { "disabled", nullptr },
+      { "enabled",  nullptr },
+      { nullptr, nullptr }
+    },
+    "disabled"
+  },
   {
     Libretro::Options::audio::CALL_BACK_AUDIO,
     "Audio / DSP > Async Audio Callback",
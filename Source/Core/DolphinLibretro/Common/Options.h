@@ -135,6 +135,7 @@ namespace core {
   constexpr const char CPU_CLOCK_RATE[] = "dolphin_cpu_clock_rate";
   constexpr const char EMULATION_SPEED[] = "dolphin_emulation_speed";
   constexpr const char MAIN_CPU_THREAD[] = "dolphin_main_cpu_thread";
+  constexpr const char FRAME_PIPELINE_LATENCY[] = "dolphin_frame_pipeline_latency";
   constexpr const char MAIN_PRECISION_FRAME_TIMING[] = "dolphin_precision_frame_timing";
   constexpr const char FASTMEM[] = "dolphin_fastmem";
   constexpr const char FASTMEM_ARENA[] = "dolphin_fastmem_arena";
@@ -155,6 +156,7 @@ namespace core {
   namespace audio {
   constexpr const char DSP_HLE[] = "dolphin_dsp_hle";
   constexpr const char DSP_JIT[] = "dolphin_dsp_jit";
+  constexpr const char DSP_HLE_THREAD[] = "dolphin_dsp_hle_thread";
   constexpr const char CALL_BACK_AUDIO[] = "dolphin_call_back_audio_method";
 }  // namespace audio
 
@@ -78,7 +78,21 @@ double g_core_refresh_rate{0};
 // Reset per game (see retro_run): the first refresh-rate settle after boot must not
 // trigger a mode-family reinit, only a real in-game 50<->60 switch should.
 static bool s_refresh_rate_settled = false;
+// Pipelined dual core mode: set when the CPU thread was released on the next frame at the end
+// of retro_run and the GPU work of that frame has not been joined yet.
+static bool s_frame_in_flight = false;
 extern void reload_cheats_from_ini();
+
+// Waits for the frame the CPU thread is emulating ahead of the frontend, so that
+// savestates and shutdown observe the machine at a frame boundary.
+void JoinPipelinedFrame()
+{
+  if (!s_frame_in_flight)
+    return;
+
+  Core::System::GetInstance().GetFifo().RunGpuLoop();
+  s_frame_in_flight = false;
+}
 }  // namespace Libretro
 
 extern "C" {
@@ -196,11 +210,17 @@ void retro_get_system_av_info(retro_system_av_info* info)
 
 void retro_reset(void)
 {
+  Libretro::JoinPipelinedFrame();
   Core::System::GetInstance().GetProcessorInterface().ResetButton_Tap();
 }
 
 void retro_run(void)
 {
+  // The frame released at the end of the previous retro_run is the one presented now. It has to be
+  // joined before options and input are applied, as those aren't synchronized with the CPU thread.
+  const bool frame_was_pipelined = Libretro::s_frame_in_flight;
+  Libretro::JoinPipelinedFrame();
+
   Libretro::Input::InitSensors();
   Libretro::Options::CheckForUpdatedVariables();
   Libretro::FrameTiming::CheckForFastForwarding();
@@ -478,8 +498,20 @@ void retro_run(void)
 
   if (system.IsDualCoreMode())
   {
-    Core::DoFrameStep(system);
-    system.GetFifo().RunGpuLoop();
+    // With a latency budget of one frame the CPU thread was already released on this frame at the
+    // end of the previous retro_run, and it was joined at the top.
+    if (!frame_was_pipelined)
+    {
+      Core::DoFrameStep(system);
+      system.GetFifo().RunGpuLoop();
+    }
+
+    if (Libretro::Options::GetCached<int>(Libretro::Options::core::FRAME_PIPELINE_LATENCY, 0) > 0)
+    {
+      // Let the CPU thread emulate the next frame while the frontend presents this one.
+      Core::DoFrameStep(system);
+      Libretro::s_frame_in_flight = true;
+    }
   }
   else
   {
@@ -506,6 +538,7 @@ size_t retro_serialize_size(void)
   size_t size = 0;
 
   Core::System& system = Core::System::GetInstance();
+  Libretro::JoinPipelinedFrame();
   AsyncRequests* ar = AsyncRequests::GetInstance();
 
   if (system.IsDualCoreMode())
@@ -525,6 +558,7 @@ size_t retro_serialize_size(void)
 bool retro_serialize(void* data, size_t size)
 {
   Core::System& system = Core::System::GetInstance();
+  Libretro::JoinPipelinedFrame();
   AsyncRequests* ar = AsyncRequests::GetInstance();
 
   if (system.IsDualCoreMode())
@@ -551,6 +585,7 @@ bool retro_serialize(void* data, size_t size)
 bool retro_unserialize(const void* data, size_t size)
 {
   Core::System& system = Core::System::GetInstance();
+  Libretro::JoinPipelinedFrame();
   AsyncRequests* ar = AsyncRequests::GetInstance();
 
   if (system.IsDualCoreMode())
@@ -3,6 +3,7 @@
 
 #include "DolphinQt/MenuBar.h"
 
+#include <ctime>
 #include <future>
 
 #include <QAction>
@@ -15,12 +16,14 @@
 #include <QMap>
 #include <QUrl>
 
+#include <fmt/chrono.h>
 #include <fmt/format.h>
 
 #include "Common/Align.h"
 #include "Common/CommonPaths.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/TimeUtil.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CommonTitles.h"
@@ -159,6 +162,12 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   m_jit_search_instruction->setEnabled(running);
   m_jit_wipe_profiling_data->setEnabled(jit_exists);
   m_jit_write_cache_log_dump->setEnabled(jit_exists);
+  const bool tracing =
+      Core::System::GetInstance().GetPowerPC().GetExecutionTrace().GetRecordingActive();
+  m_jit_record_execution_trace->setEnabled(
+      Core::System::GetInstance().GetJitInterface().SupportsExecutionTrace());
+  SignalBlocking(m_jit_record_execution_trace)->setChecked(tracing);
+  m_jit_trace_memory_accesses->setEnabled(!tracing);
 
   // Symbols
   m_symbols->setEnabled(running);
@@ -236,6 +245,38 @@ void MenuBar::OnWriteJitBlockLogDump()
   }
 }
 
+void MenuBar::OnRecordExecutionTrace(bool enabled)
+{
+  auto& system = Core::System::GetInstance();
+  auto& execution_trace = system.GetPowerPC().GetExecutionTrace();
+  const Core::CPUThreadGuard guard(system);
+  if (!enabled)
+  {
+    execution_trace.Stop(guard);
+    m_jit_trace_memory_accesses->setEnabled(true);
+    return;
+  }
+
+  // Homebrew and the like have no game ID.
+  std::string name = SConfig::GetInstance().GetGameID();
+  if (name.empty())
+  {
+    const auto local_time = Common::LocalTime(std::time(nullptr));
+    name = local_time ? fmt::format("trace_{:%Y-%m-%d_%H-%M-%S}", *local_time) : "trace";
+  }
+  const std::string filename =
+      fmt::format("{}{}.dtrace", File::GetUserPath(D_DUMPDEBUG_IDX), name);
+  if (!execution_trace.Start(guard, filename, m_jit_trace_memory_accesses->isChecked()))
+  {
+    SignalBlocking(m_jit_record_execution_trace)->setChecked(false);
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+    return;
+  }
+  m_jit_trace_memory_accesses->setEnabled(false);
+}
+
 void MenuBar::AddFileMenu()
 {
   QMenu* file_menu = addMenu(tr("&File"));
@@ -971,6 +1012,14 @@ void MenuBar::AddJITMenu()
 
   m_jit->addSeparator();
 
+  m_jit_record_execution_trace = m_jit->addAction(tr("Record Execution Trace"));
+  m_jit_record_execution_trace->setCheckable(true);
+  connect(m_jit_record_execution_trace, &QAction::toggled, this, &MenuBar::OnRecordExecutionTrace);
+  m_jit_trace_memory_accesses = m_jit->addAction(tr("Include Memory Accesses in Execution Trace"));
+  m_jit_trace_memory_accesses->setCheckable(true);
+
+  m_jit->addSeparator();
+
   m_jit_off = m_jit->addAction(tr("JIT Off (JIT Core)"));
   m_jit_off->setCheckable(true);
   m_jit_off->setChecked(Config::Get(Config::MAIN_DEBUG_JIT_OFF));
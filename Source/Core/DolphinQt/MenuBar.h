@@ -201,6 +201,7 @@ private:
   void OnDebugModeToggled(bool enabled);
   void OnWipeJitBlockProfilingData();
   void OnWriteJitBlockLogDump();
+  void OnRecordExecutionTrace(bool enabled);
 
   QString GetSignatureSelector() const;
 
@@ -297,6 +298,8 @@ private:
   QAction* m_jit_profile_blocks;
   QAction* m_jit_wipe_profiling_data;
   QAction* m_jit_write_cache_log_dump;
+  QAction* m_jit_record_execution_trace;
+  QAction* m_jit_trace_memory_accesses;
   QAction* m_jit_off;
   QAction* m_jit_loadstore_off;
   QAction* m_jit_loadstore_lbzx_off;
@@ -9,11 +9,19 @@
 #include <cstring>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 #include <pugixml.hpp>
@@ -27,6 +35,7 @@
 #include "Common/HttpRequest.h"
 #include "Common/IOFile.h"
 #include "Common/Image.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
@@ -96,11 +105,119 @@ GameFile::LookupUsingConfigLanguage(const std::map<DiscIO::Language, std::string
   return Lookup(GetConfigLanguage(), strings);
 }
 
-GameFile::GameFile() = default;
+// Uses a single system call, since this runs for every game of the library on each refresh.
+static std::pair<u64, s64> GetHostFileSizeAndTime(const std::string& path)
+{
+#ifdef _WIN32
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  if (!GetFileAttributesExW(UTF8ToWString(path).c_str(), GetFileExInfoStandard, &data))
+    return {0, 0};
+  return {(u64{data.nFileSizeHigh} << 32) | data.nFileSizeLow,
+          static_cast<s64>((u64{data.ftLastWriteTime.dwHighDateTime} << 32) |
+                           data.ftLastWriteTime.dwLowDateTime)};
+#else
+  struct stat file_info;
+  if (stat(path.c_str(), &file_info) != 0)
+    return {0, 0};
+#ifdef __APPLE__
+  const timespec& time = file_info.st_mtimespec;
+#else
+  const timespec& time = file_info.st_mtim;
+#endif
+  return {static_cast<u64>(file_info.st_size), s64{time.tv_sec} * 1000000000 + time.tv_nsec};
+#endif
+}
+
+GameImageSource::GameImageSource(GameImages images)
+    : m_has_volume_banner(!images.volume_banner.empty()),
+      m_has_custom_banner(!images.custom_banner.empty()),
+      m_has_default_cover(!images.default_cover.empty()),
+      m_has_custom_cover(!images.custom_cover.empty()), m_images(std::move(images))
+{
+}
+
+GameImageSource::GameImageSource(std::span<const u8> data, std::shared_ptr<const void> owner)
+    : m_data(data), m_owner(std::move(owner))
+{
+  // Serialize() puts which images are present in front of them.
+  if (m_data.size() >= 4)
+  {
+    m_has_volume_banner = m_data[0] != 0;
+    m_has_custom_banner = m_data[1] != 0;
+    m_has_default_cover = m_data[2] != 0;
+    m_has_custom_cover = m_data[3] != 0;
+  }
+}
+
+const GameImages& GameImageSource::Get() const
+{
+  std::lock_guard lk(m_mutex);
+  if (!m_images)
+  {
+    m_images.emplace();
+    if (m_data.size() >= 4)
+    {
+      u8* ptr = const_cast<u8*>(m_data.data() + 4);
+      PointerWrap p(&ptr, m_data.size() - 4, PointerWrap::Mode::Read);
+      m_images->DoState(p);
+      if (!p.IsReadMode())
+      {
+        ERROR_LOG_FMT(COMMON, "Failed to read cached game images");
+        m_images.emplace();
+      }
+    }
+
+    // The serialized images aren't needed anymore.
+    m_data = {};
+    m_owner.reset();
+    m_detached_data = {};
+  }
+  return *m_images;
+}
+
+std::vector<u8> GameImageSource::Serialize() const
+{
+  std::lock_guard lk(m_mutex);
+  if (!m_images)
+    return std::vector<u8>(m_data.begin(), m_data.end());
+
+  GameImages& images = *m_images;
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  images.DoState(p_measure);
+  const size_t size = reinterpret_cast<size_t>(ptr);
+
+  std::vector<u8> buffer(4 + size);
+  buffer[0] = m_has_volume_banner;
+  buffer[1] = m_has_custom_banner;
+  buffer[2] = m_has_default_cover;
+  buffer[3] = m_has_custom_cover;
+  ptr = buffer.data() + 4;
+  PointerWrap p(&ptr, size, PointerWrap::Mode::Write);
+  images.DoState(p);
+  return buffer;
+}
+
+void GameImageSource::Detach() const
+{
+  std::lock_guard lk(m_mutex);
+  if (!m_owner)
+    return;
+
+  m_detached_data.assign(m_data.begin(), m_data.end());
+  m_data = m_detached_data;
+  m_owner.reset();
+}
+
+GameFile::GameFile() : m_images(std::make_shared<GameImageSource>(GameImages{}))
+{
+}
 
 GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 {
+  GameImages images;
   m_file_name = PathToFileName(m_file_path);
+  std::tie(m_host_file_size, m_host_file_time) = GetHostFileSizeAndTime(m_file_path);
 
   {
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolume(m_file_path));
@@ -135,7 +252,8 @@ GameFile::GameFile(std::string path) : m_file_path(std::move(path))
       m_is_two_disc_game = CheckIfTwoDiscGame(m_game_id);
       m_apploader_date = volume->GetApploaderDate();
 
-      m_volume_banner.buffer = volume->GetBanner(&m_volume_banner.width, &m_volume_banner.height);
+      images.volume_banner.buffer =
+          volume->GetBanner(&images.volume_banner.width, &images.volume_banner.height);
 
       m_valid = true;
     }
@@ -180,6 +298,8 @@ GameFile::GameFile(std::string path) : m_file_path(std::move(path))
       }
     }
   }
+
+  m_images = std::make_shared<GameImageSource>(std::move(images));
 }
 
 GameFile::~GameFile() = default;
@@ -195,9 +315,14 @@ bool GameFile::IsValid() const
   return true;
 }
 
+bool GameFile::IsOutdated() const
+{
+  return GetHostFileSizeAndTime(m_file_path) != std::pair(m_host_file_size, m_host_file_time);
+}
+
 bool GameFile::CustomCoverChanged()
 {
-  if (!m_custom_cover.buffer.empty() || !UseGameCovers())
+  if (m_images->HasCustomCover() || !UseGameCovers())
     return false;
 
   std::string path, name;
@@ -224,7 +349,7 @@ bool GameFile::CustomCoverChanged()
 
 void GameFile::DownloadDefaultCover()
 {
-  if (!m_default_cover.buffer.empty() || !UseGameCovers() || m_gametdb_id.empty())
+  if (m_images->HasDefaultCover() || !UseGameCovers() || m_gametdb_id.empty())
     return;
 
   const auto cover_path = File::GetUserPath(D_COVERCACHE_IDX) + DIR_SEP;
@@ -249,7 +374,7 @@ void GameFile::DownloadDefaultCover()
 
 bool GameFile::DefaultCoverChanged()
 {
-  if (!m_default_cover.buffer.empty() || !UseGameCovers())
+  if (m_images->HasDefaultCover() || !UseGameCovers())
     return false;
 
   const auto cover_path = File::GetUserPath(D_COVERCACHE_IDX) + DIR_SEP;
@@ -268,12 +393,24 @@ bool GameFile::DefaultCoverChanged()
 
 void GameFile::CustomCoverCommit()
 {
-  m_custom_cover = std::move(m_pending.custom_cover);
+  GameImages images = m_images->Get();
+  images.custom_cover = std::move(m_pending.custom_cover);
+  m_images = std::make_shared<GameImageSource>(std::move(images));
 }
 
 void GameFile::DefaultCoverCommit()
 {
-  m_default_cover = std::move(m_pending.default_cover);
+  GameImages images = m_images->Get();
+  images.default_cover = std::move(m_pending.default_cover);
+  m_images = std::make_shared<GameImageSource>(std::move(images));
+}
+
+void GameImages::DoState(PointerWrap& p)
+{
+  volume_banner.DoState(p);
+  custom_banner.DoState(p);
+  default_cover.DoState(p);
+  custom_cover.DoState(p);
 }
 
 void GameBanner::DoState(PointerWrap& p)
@@ -295,6 +432,8 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_file_name);
 
   p.Do(m_file_size);
+  p.Do(m_host_file_size);
+  p.Do(m_host_file_time);
   p.Do(m_volume_size);
   p.Do(m_volume_size_type);
   p.Do(m_is_datel_disc);
@@ -325,10 +464,11 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_custom_name);
   p.Do(m_custom_description);
   p.Do(m_custom_maker);
-  m_volume_banner.DoState(p);
-  m_custom_banner.DoState(p);
-  m_default_cover.DoState(p);
-  m_custom_cover.DoState(p);
+}
+
+void GameFile::SetImageSource(std::shared_ptr<const GameImageSource> images)
+{
+  m_images = std::move(images);
 }
 
 std::string GameFile::GetExtension() const
@@ -403,10 +543,10 @@ bool GameFile::WiiBannerChanged()
   // In case the cache was created without a save file existing,
   // let's try reading the save file again, because it might exist now.
 
-  if (!m_volume_banner.empty())
-    return false;
   if (!DiscIO::IsWii(m_platform))
     return false;
+  if (m_images->HasVolumeBanner())
+    return false;
 
   m_pending.volume_banner.buffer =
       DiscIO::WiiSaveBanner(m_title_id)
@@ -419,7 +559,9 @@ bool GameFile::WiiBannerChanged()
 
 void GameFile::WiiBannerCommit()
 {
-  m_volume_banner = std::move(m_pending.volume_banner);
+  GameImages images = m_images->Get();
+  images.volume_banner = std::move(m_pending.volume_banner);
+  m_images = std::make_shared<GameImageSource>(std::move(images));
 }
 
 bool GameFile::ReadPNGBanner(const std::string& path)
@@ -481,12 +623,17 @@ bool GameFile::CustomBannerChanged()
     }
   }
 
-  return m_pending.custom_banner != m_custom_banner;
+  // Only deserialize the current banner if there's a new one to compare it with.
+  if (m_pending.custom_banner.empty())
+    return m_images->HasCustomBanner();
+  return !m_images->HasCustomBanner() || m_pending.custom_banner != m_images->Get().custom_banner;
 }
 
 void GameFile::CustomBannerCommit()
 {
-  m_custom_banner = std::move(m_pending.custom_banner);
+  GameImages images = m_images->Get();
+  images.custom_banner = std::move(m_pending.custom_banner);
+  m_images = std::make_shared<GameImageSource>(std::move(images));
 }
 
 const std::string& GameFile::GetName(const Core::TitleDatabase& title_database) const
@@ -853,12 +1000,14 @@ bool GameFile::IsModDescriptor() const
 
 const GameBanner& GameFile::GetBannerImage() const
 {
-  return m_custom_banner.empty() ? m_volume_banner : m_custom_banner;
+  const GameImages& images = m_images->Get();
+  return images.custom_banner.empty() ? images.volume_banner : images.custom_banner;
 }
 
 const GameCover& GameFile::GetCoverImage() const
 {
-  return m_custom_cover.empty() ? m_default_cover : m_custom_cover;
+  const GameImages& images = m_images->Get();
+  return images.custom_cover.empty() ? images.default_cover : images.custom_cover;
 }
 
 }  // namespace UICommon
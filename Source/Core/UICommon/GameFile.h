@@ -5,6 +5,10 @@
 
 #include <array>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -41,6 +45,50 @@ struct GameCover
   void DoState(PointerWrap& p);
 };
 
+struct GameImages
+{
+  GameBanner volume_banner;
+  GameBanner custom_banner;
+  GameCover default_cover;
+  GameCover custom_cover;
+
+  void DoState(PointerWrap& p);
+};
+
+// The images of a GameFile, which make up most of the game list cache. When they come from the
+// cache, they are only deserialized from the mapped cache file once they are accessed, since most
+// games of a large library never get displayed.
+class GameImageSource final
+{
+public:
+  explicit GameImageSource(GameImages images);
+  // `data` must come from Serialize() and stay valid for as long as `owner` is alive.
+  GameImageSource(std::span<const u8> data, std::shared_ptr<const void> owner);
+
+  const GameImages& Get() const;
+  std::vector<u8> Serialize() const;
+  // Copies the serialized images out of the memory owned by `owner`, so that it can be released.
+  void Detach() const;
+
+  // These don't need the images to be deserialized.
+  bool HasVolumeBanner() const { return m_has_volume_banner; }
+  bool HasCustomBanner() const { return m_has_custom_banner; }
+  bool HasDefaultCover() const { return m_has_default_cover; }
+  bool HasCustomCover() const { return m_has_custom_cover; }
+
+private:
+  bool m_has_volume_banner = false;
+  bool m_has_custom_banner = false;
+  bool m_has_default_cover = false;
+  bool m_has_custom_cover = false;
+
+  mutable std::mutex m_mutex;
+  mutable std::optional<GameImages> m_images;
+  mutable std::span<const u8> m_data;
+  mutable std::shared_ptr<const void> m_owner;
+  mutable std::vector<u8> m_detached_data;
+};
+
 // This class caches the metadata of a DiscIO::Volume (or a DOL/ELF file).
 class GameFile final
 {
@@ -57,6 +105,8 @@ public:
   ~GameFile();
 
   bool IsValid() const;
+  // Returns true if the file on disk was modified after this GameFile was created.
+  bool IsOutdated() const;
   const std::string& GetFilePath() const { return m_file_path; }
   const std::string& GetFileName() const { return m_file_name; }
   const std::string& GetName(const Core::TitleDatabase& title_database) const;
@@ -111,7 +161,10 @@ public:
   bool IsModDescriptor() const;
   const GameBanner& GetBannerImage() const;
   const GameCover& GetCoverImage() const;
+  // The images aren't included, GameFileCache stores them separately.
   void DoState(PointerWrap& p);
+  const std::shared_ptr<const GameImageSource>& GetImageSource() const { return m_images; }
+  void SetImageSource(std::shared_ptr<const GameImageSource> images);
   bool XMLMetadataChanged();
   void XMLMetadataCommit();
   bool WiiBannerChanged();
@@ -146,6 +199,9 @@ private:
   std::string m_file_name;
 
   u64 m_file_size{};
+  // Size and modification time of m_file_path on the host, for IsOutdated.
+  u64 m_host_file_size{};
+  s64 m_host_file_time{};
   u64 m_volume_size{};
   DiscIO::DataSizeType m_volume_size_type{};
   bool m_is_datel_disc{};
@@ -176,10 +232,8 @@ private:
   std::string m_custom_name;
   std::string m_custom_description;
   std::string m_custom_maker;
-  GameBanner m_volume_banner{};
-  GameBanner m_custom_banner{};
-  GameCover m_default_cover{};
-  GameCover m_custom_cover{};
+  // Never null. Shared with copies of this GameFile, and replaced rather than modified.
+  std::shared_ptr<const GameImageSource> m_images;
 
   // The following data members allow GameFileCache to construct updated versions
   // of GameFiles in a threadsafe way. They should not be handled in DoState.
@@ -4,9 +4,16 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -16,6 +23,7 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -23,7 +31,16 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 27;  // Last changed in PR 13844
+static constexpr u32 CACHE_REVISION = 29;  // Last changed for lazily loaded images
+
+static constexpr size_t MIN_ENTRIES_PER_LOAD_THREAD = 256;
+static constexpr size_t MAX_LOAD_THREADS = 8;
+
+// Scanning is dominated by I/O latency rather than CPU time, so some parallelism helps even on
+// machines with few cores, in particular for network shares. The limit is kept low so that
+// spinning disks aren't slowed down by too many concurrent seeks.
+static constexpr size_t MAX_SEARCH_THREADS = 4;
+static constexpr size_t MAX_SCAN_THREADS = 4;
 
 std::vector<std::string> FindAllGamePaths(std::span<const std::string_view> directories_to_scan,
                                           bool recursive_scan)
@@ -33,13 +50,35 @@ std::vector<std::string> FindAllGamePaths(std::span<const std::string_view> dire
                                        ".wia", ".rvz", ".nfs", ".wad", ".dol", ".elf", ".json"});
 
   // TODO: We could process paths iteratively as they are found
-  return Common::DoFileSearch(directories_to_scan, search_extensions, recursive_scan);
+  return Common::DoFileSearch(directories_to_scan, search_extensions, recursive_scan,
+                              MAX_SEARCH_THREADS);
 }
 
 GameFileCache::GameFileCache() : m_path(File::GetUserPath(D_CACHE_IDX) + "gamelist.cache")
 {
 }
 
+// Images loaded by Load() point into the mapped cache file. This must be called before a GameFile
+// leaves the cache, so that the file isn't kept mapped by GameFiles that Save() can't reach.
+static void DetachFromCacheFile(const GameFile& game_file)
+{
+  game_file.GetImageSource()->Detach();
+}
+
+template <typename Function>
+static void RunOnThreads(size_t max_thread_count, size_t work_count, const Function& function)
+{
+  const size_t thread_count =
+      std::min(work_count, std::clamp<size_t>(std::thread::hardware_concurrency(), 1,
+                                              max_thread_count));
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_count; ++i)
+    threads.emplace_back(function);
+  function();
+  for (std::thread& thread : threads)
+    thread.join();
+}
+
 void GameFileCache::ForEach(const ForEachFn& f) const
 {
   for (const std::shared_ptr<GameFile>& item : m_cached_files)
@@ -53,10 +92,12 @@ size_t GameFileCache::GetSize() const
 
 void GameFileCache::Clear(DeleteOnDisk delete_on_disk)
 {
+  for (const std::shared_ptr<GameFile>& file : m_cached_files)
+    DetachFromCacheFile(*file);
+  m_cached_files.clear();
+
   if (delete_on_disk != DeleteOnDisk::No)
     File::Delete(m_path);
-
-  m_cached_files.clear();
 }
 
 std::shared_ptr<const GameFile> GameFileCache::AddOrGet(const std::string& path,
@@ -96,42 +137,100 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
 
   bool cache_changed = false;
 
-  // Delete paths that aren't in game_paths from m_cached_files,
+  // Checking whether files changed on disk costs a system call per file, which adds up for large
+  // libraries on network shares, so this is done on multiple threads first.
+  std::vector<u8> outdated(m_cached_files.size());
+  {
+    std::atomic<size_t> next_file = 0;
+    RunOnThreads(MAX_SCAN_THREADS, m_cached_files.size(), [&] {
+      for (size_t i = next_file++; i < m_cached_files.size() && !processing_halted;
+           i = next_file++)
+      {
+        const GameFile& file = *m_cached_files[i];
+        outdated[i] = game_paths.contains(file.GetFilePath()) && file.IsOutdated();
+      }
+    });
+  }
+
+  // Delete paths that aren't in game_paths (or whose files have changed) from m_cached_files,
   // while simultaneously deleting paths that are in m_cached_files from game_paths.
   // For the sake of speed, we don't care about maintaining the order of m_cached_files.
   {
-    auto it = m_cached_files.begin();
-    auto end = m_cached_files.end();
-    while (it != end)
+    size_t i = 0;
+    size_t end = m_cached_files.size();
+    while (i != end)
     {
       if (processing_halted)
         break;
 
-      if (game_paths.erase((*it)->GetFilePath()))
+      // Files that changed on disk are removed here and added again by the loop below.
+      const auto path_it = game_paths.find(m_cached_files[i]->GetFilePath());
+      if (path_it != game_paths.end() && !outdated[i])
       {
-        ++it;
+        game_paths.erase(path_it);
+        ++i;
       }
       else
       {
         if (game_removed_from_cache)
-          game_removed_from_cache((*it)->GetFilePath());
+          game_removed_from_cache(m_cached_files[i]->GetFilePath());
 
         cache_changed = true;
+        DetachFromCacheFile(*m_cached_files[i]);
         --end;
-        *it = std::move(*end);
+        m_cached_files[i] = std::move(m_cached_files[end]);
+        outdated[i] = outdated[end];
       }
     }
-    m_cached_files.erase(it, m_cached_files.end());
+    m_cached_files.erase(m_cached_files.begin() + i, m_cached_files.end());
   }
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  // Constructing a GameFile opens and parses the file, so this is done on multiple threads, but
+  // the files are added (and reported to game_added_to_cache) in a deterministic order.
+  std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  std::ranges::sort(new_paths);
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::shared_ptr<GameFile>> new_files(new_paths.size());
+  std::vector<bool> constructed(new_paths.size());
+  std::atomic<size_t> next_path = 0;
+
+  const auto construct_files = [&] {
+    for (size_t i = next_path++; i < new_paths.size() && !processing_halted; i = next_path++)
+    {
+      auto file = std::make_shared<GameFile>(new_paths[i]);
+      std::lock_guard lk(mutex);
+      new_files[i] = std::move(file);
+      constructed[i] = true;
+      cv.notify_all();
+    }
+
+    // Wake up the waiting loop below if this thread stopped because processing was halted.
+    std::lock_guard lk(mutex);
+    cv.notify_all();
+  };
+
+  const size_t thread_count =
+      std::min(new_paths.size(),
+               std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MAX_SCAN_THREADS));
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < thread_count; ++i)
+    threads.emplace_back(construct_files);
+
+  for (size_t i = 0; i < new_paths.size(); ++i)
   {
-    if (processing_halted)
-      break;
+    std::shared_ptr<GameFile> file;
+    {
+      std::unique_lock lk(mutex);
+      cv.wait(lk, [&] { return constructed[i] || processing_halted; });
+      if (!constructed[i])
+        break;
+      file = std::move(new_files[i]);
+    }
 
-    auto file = std::make_shared<GameFile>(path);
     if (file->IsValid())
     {
       if (game_added_to_cache)
@@ -142,6 +241,9 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
     }
   }
 
+  for (std::thread& thread : threads)
+    thread.join();
+
   return cache_changed;
 }
 
@@ -196,86 +298,176 @@ bool GameFileCache::UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_fil
   if (custom_cover_changed)
     copy->CustomCoverCommit();
 
+  if (copy->GetImageSource() != (*game_file)->GetImageSource())
+    DetachFromCacheFile(**game_file);
   *game_file = std::move(copy);
 
   return true;
 }
 
-bool GameFileCache::Load()
+// The cache file starts with a header and the location of every entry, so that entries can be
+// loaded independently of each other (and in parallel), and a bad entry only loses that entry.
+// The file is mapped rather than read, and the images of each entry, which make up most of it, are
+// only deserialized once they are accessed.
+struct CacheHeader
 {
-  return SyncCacheFile(false);
+  u32 revision;
+  u32 entry_count;
+  u64 file_size;
+};
+
+// The images of an entry directly follow its other data.
+struct CacheIndexEntry
+{
+  u64 offset;
+  u64 size;
+  u64 images_size;
+};
+
+static std::vector<u8> SerializeGameFile(GameFile& game_file)
+{
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  game_file.DoState(p_measure);
+  const size_t size = reinterpret_cast<size_t>(ptr);
+
+  std::vector<u8> buffer(size);
+  ptr = buffer.data();
+  PointerWrap p(&ptr, size, PointerWrap::Mode::Write);
+  game_file.DoState(p);
+  return buffer;
 }
 
-bool GameFileCache::Save()
+static std::shared_ptr<GameFile> DeserializeGameFile(std::span<const u8> data)
 {
-  return SyncCacheFile(true);
+  auto game_file = std::make_shared<GameFile>();
+  // PointerWrap doesn't write to the buffer in read mode.
+  u8* ptr = const_cast<u8*>(data.data());
+  PointerWrap p(&ptr, data.size(), PointerWrap::Mode::Read);
+  game_file->DoState(p);
+  if (!p.IsReadMode() || ptr != data.data() + data.size())
+    return nullptr;
+  return game_file;
 }
 
-bool GameFileCache::SyncCacheFile(bool save)
+bool GameFileCache::Load()
 {
-  const char* open_mode = save ? "wb" : "rb";
-  File::IOFile f(m_path, open_mode);
-  if (!f)
+  auto file = std::make_shared<File::MappedFile>(m_path);
+  if (!file->IsOpen())
     return false;
-  bool success = false;
-  if (save)
+
+  const std::span<const u8> data = file->GetData();
+  CacheHeader header;
+  if (data.size() < sizeof(header))
+    return DeleteCacheFile(file.get());
+
+  std::memcpy(&header, data.data(), sizeof(header));
+  const size_t index_size = size_t{header.entry_count} * sizeof(CacheIndexEntry);
+  if (header.revision != CACHE_REVISION || header.file_size != data.size() ||
+      index_size > data.size() - sizeof(header))
   {
-    // Measure the size of the buffer.
-    u8* ptr = nullptr;
-    PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-    DoState(&p_measure);
-    const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-    // Then actually do the write.
-    std::vector<u8> buffer(buffer_size);
-    ptr = buffer.data();
-    PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-    DoState(&p, buffer_size);
-    if (f.WriteBytes(buffer.data(), buffer.size()))
-      success = true;
+    return DeleteCacheFile(file.get());
   }
-  else
-  {
-    std::vector<u8> buffer(f.GetSize());
-    if (!buffer.empty() && f.ReadBytes(buffer.data(), buffer.size()))
+
+  std::vector<CacheIndexEntry> index(header.entry_count);
+  std::memcpy(index.data(), data.data() + sizeof(header), index_size);
+
+  std::vector<std::shared_ptr<GameFile>> loaded_files(index.size());
+  std::atomic<size_t> next_entry = 0;
+  std::atomic<bool> all_loaded = true;
+  const auto load_entries = [&] {
+    for (size_t i = next_entry++; i < index.size(); i = next_entry++)
     {
-      u8* ptr = buffer.data();
-      PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
-      DoState(&p, buffer.size());
-      if (p.IsReadMode())
-        success = true;
+      const CacheIndexEntry& entry = index[i];
+      if (entry.offset > data.size() || entry.size > data.size() - entry.offset ||
+          entry.images_size > data.size() - entry.offset - entry.size)
+      {
+        all_loaded = false;
+        continue;
+      }
+
+      loaded_files[i] = DeserializeGameFile(data.subspan(entry.offset, entry.size));
+      if (!loaded_files[i])
+      {
+        all_loaded = false;
+        continue;
+      }
+
+      loaded_files[i]->SetImageSource(std::make_shared<GameImageSource>(
+          data.subspan(entry.offset + entry.size, entry.images_size), file));
     }
-  }
-  if (!success)
+  };
+
+  // Entries are independent of each other, so they can be materialized on multiple threads.
+  RunOnThreads(MAX_LOAD_THREADS, std::max<size_t>(index.size() / MIN_ENTRIES_PER_LOAD_THREAD, 1),
+               load_entries);
+
+  for (const std::shared_ptr<GameFile>& cached_file : m_cached_files)
+    DetachFromCacheFile(*cached_file);
+  m_cached_files.clear();
+  m_cached_files.reserve(loaded_files.size());
+  for (std::shared_ptr<GameFile>& loaded_file : loaded_files)
   {
-    // If some file operation failed, try to delete the probably-corrupted cache
-    f.Close();
-    File::Delete(m_path);
+    if (loaded_file)
+      m_cached_files.push_back(std::move(loaded_file));
   }
-  return success;
+
+  // The valid entries are kept, and the next Save() drops the others from the file.
+  return all_loaded;
 }
 
-void GameFileCache::DoState(PointerWrap* p, u64 size)
+bool GameFileCache::Save()
 {
-  struct
+  std::vector<std::vector<u8>> entries;
+  std::vector<std::vector<u8>> images;
+  entries.reserve(m_cached_files.size());
+  images.reserve(m_cached_files.size());
+  for (const std::shared_ptr<GameFile>& file : m_cached_files)
+  {
+    entries.push_back(SerializeGameFile(*file));
+    images.push_back(file->GetImageSource()->Serialize());
+  }
+
+  // Nothing may point into the mapped cache file anymore when it gets truncated.
+  for (const std::shared_ptr<GameFile>& file : m_cached_files)
+    DetachFromCacheFile(*file);
+
+  CacheHeader header{CACHE_REVISION, static_cast<u32>(entries.size()), 0};
+  std::vector<CacheIndexEntry> index(entries.size());
+  u64 offset = sizeof(header) + entries.size() * sizeof(CacheIndexEntry);
+  for (size_t i = 0; i < entries.size(); ++i)
   {
-    u32 revision;
-    u64 expected_size;
-  } header = {CACHE_REVISION, size};
-  p->Do(header);
-  if (p->IsReadMode())
+    index[i] = {offset, entries[i].size(), images[i].size()};
+    offset += entries[i].size() + images[i].size();
+  }
+  header.file_size = offset;
+
+  File::IOFile f(m_path, "wb");
+  if (!f)
+    return false;
+
+  bool success = f.WriteArray(&header, 1) && f.WriteArray(index.data(), index.size());
+  for (size_t i = 0; i < entries.size(); ++i)
   {
-    if (header.revision != CACHE_REVISION || header.expected_size != size)
-    {
-      p->SetMeasureMode();
-      return;
-    }
+    success = success && f.WriteBytes(entries[i].data(), entries[i].size()) &&
+              f.WriteBytes(images[i].data(), images[i].size());
   }
-  p->DoEachElement(m_cached_files, [](PointerWrap& state, std::shared_ptr<GameFile>& elem) {
-    if (state.IsReadMode())
-      elem = std::make_shared<GameFile>();
-    elem->DoState(state);
-  });
+
+  if (!success)
+  {
+    f.Close();
+    return DeleteCacheFile();
+  }
+  return true;
+}
+
+bool GameFileCache::DeleteCacheFile(File::MappedFile* f)
+{
+  // If some file operation failed, try to delete the probably-corrupted cache
+  if (f)
+    f->Close();
+  File::Delete(m_path);
+  return false;
 }
 
 }  // namespace UICommon
@@ -13,7 +13,10 @@
 
 #include "Common/CommonTypes.h"
 
-class PointerWrap;
+namespace File
+{
+class MappedFile;
+}
 
 namespace UICommon
 {
@@ -60,8 +63,7 @@ public:
 private:
   bool UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_file);
 
-  bool SyncCacheFile(bool save);
-  void DoState(PointerWrap* p, u64 size = 0);
+  bool DeleteCacheFile(File::MappedFile* f = nullptr);
 
   std::string m_path;
   std::vector<std::shared_ptr<GameFile>> m_cached_files;
@@ -30,6 +30,18 @@ void AbstractTexture::FinishedRendering()
 }
 
 bool AbstractTexture::Save(const std::string& filename, unsigned int level, int compression) const
+{
+  std::vector<u8> data;
+  u32 width, height;
+  if (!ReadbackLevel(level, &data, &width, &height))
+    return false;
+
+  return Common::SavePNG(filename, data.data(), Common::ImageByteFormat::RGBA, width, height,
+                         width * 4, compression);
+}
+
+bool AbstractTexture::ReadbackLevel(unsigned int level, std::vector<u8>* data_out, u32* width_out,
+                                    u32* height_out) const
 {
   // We can't dump compressed textures currently (it would mean drawing them to a RGBA8
   // framebuffer, and saving that). TextureCache does not call Save for custom textures
@@ -58,14 +70,15 @@ bool AbstractTexture::Save(const std::string& filename, unsigned int level, int
   readback_texture->CopyFromTexture(this, 0, level);
   readback_texture->Flush();
 
-  // Map it so we can encode it to the file.
+  // Map it so we can copy out the texels.
   if (!readback_texture->Map())
     return false;
 
-  return Common::SavePNG(filename,
-                         reinterpret_cast<const u8*>(readback_texture->GetMappedPointer()),
-                         Common::ImageByteFormat::RGBA, level_width, level_height,
-                         static_cast<int>(readback_texture->GetMappedStride()), compression);
+  data_out->resize(size_t(level_width) * level_height * 4);
+  readback_texture->ReadTexels(readback_texture->GetRect(), data_out->data(), level_width * 4);
+  *width_out = level_width;
+  *height_out = level_height;
+  return true;
 }
 
 bool AbstractTexture::IsCompressedFormat(AbstractTextureFormat format)
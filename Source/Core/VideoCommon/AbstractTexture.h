@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
@@ -47,6 +48,10 @@ public:
   bool IsMultisampled() const { return m_config.IsMultisampled(); }
   bool Save(const std::string& filename, unsigned int level, int compression = 6) const;
 
+  // Downloads a mip level as tightly packed RGBA8 texels. Same restrictions as Save.
+  bool ReadbackLevel(unsigned int level, std::vector<u8>* data_out, u32* width_out,
+                     u32* height_out) const;
+
   static bool IsCompressedFormat(AbstractTextureFormat format);
   static bool IsDepthFormat(AbstractTextureFormat format);
   static bool IsStencilFormat(AbstractTextureFormat format);
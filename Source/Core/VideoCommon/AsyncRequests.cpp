@@ -10,10 +10,13 @@
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoEvents.h"
 
-AsyncRequests AsyncRequests::s_singleton;
-
 AsyncRequests::AsyncRequests() = default;
 
+AsyncRequests* AsyncRequests::GetInstance()
+{
+  return &Core::System::GetInstance().GetAsyncRequests();
+}
+
 void AsyncRequests::PullEvents()
 {
   if (m_queue.Empty())
@@ -51,15 +51,14 @@ public:
   // Not thread-safe. Only set during initialization.
   void SetPassthrough(bool enable);
 
-  static AsyncRequests* GetInstance() { return &s_singleton; }
+  // Returns the requests queue of System::GetInstance().
+  static AsyncRequests* GetInstance();
 
 private:
   using Event = Common::MoveOnlyFunction<void()>;
 
   void QueueEvent(Event&& event);
 
-  static AsyncRequests s_singleton;
-
   Common::WaitableSPSCQueue<Event> m_queue;
 
   bool m_passthrough = true;
@@ -138,6 +138,7 @@ void FifoManager::ExitGpuLoop()
 #ifdef __LIBRETRO__
 void FifoManager::StopGpuLoop()
 {
+  m_gpu_frame_fence.Set();
   m_gpu_mainloop.Stop(Common::BlockingLoop::StopMode::NonBlock);
 }
 #endif
@@ -297,8 +298,14 @@ void FifoManager::RunGpuLoop()
         // Run events from the CPU thread.
         AsyncRequests::GetInstance()->PullEvents();
 
-        // Do nothing while paused
-        if (!m_emu_running_state.IsSet())
+#ifdef __LIBRETRO__
+        const bool frame_pending = m_gpu_frame_fence.IsSet();
+#else
+        constexpr bool frame_pending = false;
+#endif
+
+        // Do nothing while paused, unless the CPU finished a frame that still has to be drained.
+        if (!m_emu_running_state.IsSet() && !frame_pending)
           return;
 
         if (m_use_deterministic_gpu_thread)
@@ -391,8 +398,18 @@ void FifoManager::RunGpuLoop()
           g_vertex_manager->Flush();
           g_framebuffer_manager->RefreshPeekCache();
         }
+
+#ifdef __LIBRETRO__
+        // The frame fence was raised before this loop got to run, so nobody stopped it.
+        if (frame_pending)
+          m_gpu_mainloop.Stop(Common::BlockingLoop::StopMode::NonBlock);
+#endif
       },
       100);
+
+#ifdef __LIBRETRO__
+  m_gpu_frame_fence.Clear();
+#endif
 }
 
 void FifoManager::FlushGpu()
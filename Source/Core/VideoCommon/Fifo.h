@@ -91,6 +91,12 @@ private:
 
   Common::BlockingLoop m_gpu_mainloop;
 
+#ifdef __LIBRETRO__
+  // Set by the CPU thread when it reaches the end of a frame. A GPU loop started after the fence
+  // was raised still drains the frame's commands before it returns to the frontend.
+  Common::Flag m_gpu_frame_fence;
+#endif
+
   Common::Flag m_emu_running_state;
 
   // Most of this array is unlikely to be faulted in...
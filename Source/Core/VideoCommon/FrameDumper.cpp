@@ -61,13 +61,14 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  FrameDumpSlot& slot = AcquireFrameDumpSlot();
+  if (!CheckFrameDumpReadbackTexture(slot, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  slot.readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
+                                         slot.readback_texture->GetRect());
+  slot.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  m_frame_dump_copied++;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -98,9 +99,10 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(FrameDumpSlot& slot, u32 target_width,
+                                                u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
+  std::unique_ptr<AbstractStagingTexture>& rbtex = slot.readback_texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -115,45 +117,74 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
   return true;
 }
 
+FrameDumper::FrameDumpSlot& FrameDumper::AcquireFrameDumpSlot()
+{
+  // Only block when the oldest frame in the ring still hasn't been encoded.
+  if (m_frame_dump_copied >= FRAME_DUMP_RING_SIZE)
+  {
+    const u64 oldest_frame = m_frame_dump_copied - FRAME_DUMP_RING_SIZE;
+    while (m_frame_dump_queued <= oldest_frame)
+      QueueFrameDumpReadback();
+    WaitForEncodedFrames(oldest_frame + 1);
+  }
+
+  FrameDumpSlot& slot = m_frame_dump_slots[m_frame_dump_copied % FRAME_DUMP_RING_SIZE];
+  if (slot.readback_texture && slot.readback_texture->IsMapped())
+    slot.readback_texture->Unmap();
+  return slot;
+}
+
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
+  if (m_frame_dump_queued == m_frame_dump_copied)
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
+  // Keep the most recent frames on the GPU for a bit while dumping, so that mapping them doesn't
+  // stall. Screenshots are taken right away.
+  const bool frame_dumping = IsFrameDumping();
+  const u64 latency =
+      frame_dumping && Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES) ? FRAME_DUMP_READBACK_LATENCY : 0;
+  while (m_frame_dump_copied - m_frame_dump_queued > latency)
+    QueueFrameDumpReadback();
+
+  // Shutdown frame dumping if it is no longer active.
+  if (!frame_dumping)
+    ShutdownFrameDumping();
+}
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+void FrameDumper::QueueFrameDumpReadback()
+{
+  const FrameDumpSlot& slot = m_frame_dump_slots[m_frame_dump_queued % FRAME_DUMP_RING_SIZE];
+  m_frame_dump_queued++;
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
+  // Frames which can't be mapped are still queued so that the frame counts stay in sync, the dump
+  // thread skips them.
+  AbstractStagingTexture* const output = slot.readback_texture.get();
   output->Flush();
   if (output->Map())
   {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    DumpFrameData(FrameData{reinterpret_cast<u8*>(output->GetMappedPointer()),
+                            static_cast<int>(output->GetConfig().width),
+                            static_cast<int>(output->GetConfig().height),
+                            static_cast<int>(output->GetMappedStride()), slot.state});
   }
   else
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    DumpFrameData(FrameData{nullptr, 0, 0, 0, slot.state});
   }
-
-  m_frame_dump_needs_flush = false;
-
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
 }
 
 void FrameDumper::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  // Ensure the remaining readbacks have been sent to the encoder.
+  while (m_frame_dump_queued != m_frame_dump_copied)
+    QueueFrameDumpReadback();
 
   if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  // Ensure previous frame has been encoded.
+  // Ensure all frames have been encoded.
   FinishFrameData();
 
   // Wake thread up, and wait for it to exit.
@@ -164,14 +195,12 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  for (FrameDumpSlot& slot : m_frame_dump_slots)
+    slot.readback_texture.reset();
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(const FrameData& frame)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
-
   if (!m_frame_dump_thread_running.IsSet())
   {
     if (m_frame_dump_thread.joinable())
@@ -181,19 +210,25 @@ void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
   }
 
   // Wake worker thread up.
+  m_frame_dump_queue.Push(frame);
   m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
 }
 
-void FrameDumper::FinishFrameData()
+void FrameDumper::WaitForEncodedFrames(u64 count)
 {
-  if (!m_frame_dump_frame_running)
-    return;
+  while (m_frame_dump_encoded.load(std::memory_order_acquire) < count)
+    m_frame_dump_done.Wait();
+}
 
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+void FrameDumper::FinishFrameData()
+{
+  WaitForEncodedFrames(m_frame_dump_queued);
 
-  m_frame_dump_output_texture->Unmap();
+  for (FrameDumpSlot& slot : m_frame_dump_slots)
+  {
+    if (slot.readback_texture && slot.readback_texture->IsMapped())
+      slot.readback_texture->Unmap();
+  }
 }
 
 void FrameDumper::FrameDumpThreadFunc()
@@ -216,49 +251,56 @@ void FrameDumper::FrameDumpThreadFunc()
   while (true)
   {
     m_frame_dump_start.Wait();
-    if (!m_frame_dump_thread_running.IsSet())
-      break;
-
-    auto frame = m_frame_dump_data;
 
-    // Save screenshot
-    if (m_screenshot_request.TestAndClear())
+    FrameData frame;
+    while (m_frame_dump_queue.Pop(frame))
     {
-      std::lock_guard<std::mutex> lk(m_screenshot_lock);
-
-      if (DumpFrameToPNG(frame, m_screenshot_name))
-        OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
-
-      // Reset settings
-      m_screenshot_name.clear();
-      m_screenshot_completed.Set();
-    }
-
-    if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
-    {
-      if (!frame_dump_started)
+      if (frame.data != nullptr)
       {
-        if (dump_to_ffmpeg)
-          frame_dump_started = StartFrameDumpToFFMPEG(frame);
-        else
-          frame_dump_started = StartFrameDumpToImage(frame);
-
-        // Stop frame dumping if we fail to start.
-        if (!frame_dump_started)
-          Config::SetCurrent(Config::MAIN_MOVIE_DUMP_FRAMES, false);
+        // Save screenshot
+        if (m_screenshot_request.TestAndClear())
+        {
+          std::lock_guard<std::mutex> lk(m_screenshot_lock);
+
+          if (DumpFrameToPNG(frame, m_screenshot_name))
+            OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+
+          // Reset settings
+          m_screenshot_name.clear();
+          m_screenshot_completed.Set();
+        }
+
+        if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
+        {
+          if (!frame_dump_started)
+          {
+            if (dump_to_ffmpeg)
+              frame_dump_started = StartFrameDumpToFFMPEG(frame);
+            else
+              frame_dump_started = StartFrameDumpToImage(frame);
+
+            // Stop frame dumping if we fail to start.
+            if (!frame_dump_started)
+              Config::SetCurrent(Config::MAIN_MOVIE_DUMP_FRAMES, false);
+          }
+
+          // If we failed to start frame dumping, don't write a frame.
+          if (frame_dump_started)
+          {
+            if (dump_to_ffmpeg)
+              DumpFrameToFFMPEG(frame);
+            else
+              DumpFrameToImage(frame);
+          }
+        }
       }
 
-      // If we failed to start frame dumping, don't write a frame.
-      if (frame_dump_started)
-      {
-        if (dump_to_ffmpeg)
-          DumpFrameToFFMPEG(frame);
-        else
-          DumpFrameToImage(frame);
-      }
+      m_frame_dump_encoded.fetch_add(1, std::memory_order_release);
+      m_frame_dump_done.Set();
     }
 
-    m_frame_dump_done.Set();
+    if (!m_frame_dump_thread_running.IsSet())
+      break;
   }
 
   if (frame_dump_started)
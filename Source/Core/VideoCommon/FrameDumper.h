@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
+#include "Common/SPSCQueue.h"
 #include "Common/Thread.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
@@ -49,16 +53,40 @@ private:
 
   void ShutdownFrameDumping();
 
+  // Frames are copied to a ring of readback textures, so that the GPU thread doesn't have to wait
+  // for the previous frame to be read back and encoded. Frame n uses slot n % RING_SIZE.
+  static constexpr u32 FRAME_DUMP_RING_SIZE = 4;
+
+  // Frames are only read back once they are this many frames old, so that the GPU is done with the
+  // copy by the time the texture is mapped.
+  static constexpr u32 FRAME_DUMP_READBACK_LATENCY = 2;
+
+  struct FrameDumpSlot
+  {
+    std::unique_ptr<AbstractStagingTexture> readback_texture;
+    // Emulation state of the frame held by the readback texture.
+    FrameState state;
+  };
+
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  // Checks that the readback texture of a slot exists and is the correct size.
+  bool CheckFrameDumpReadbackTexture(FrameDumpSlot& slot, u32 target_width, u32 target_height);
+
+  // Returns the slot for the next frame, waiting for the encoder if the ring is full.
+  FrameDumpSlot& AcquireFrameDumpSlot();
+
+  // Maps the readback texture of the oldest frame that hasn't been queued yet and queues it.
+  void QueueFrameDumpReadback();
 
-  // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  // Asynchronously encodes the specified frame to the frame dump.
+  void DumpFrameData(const FrameData& frame);
 
-  // Ensures all encoded frames have been written to the output file.
+  // Blocks until the frame dump thread is done with the given number of frames.
+  void WaitForEncodedFrames(u64 count);
+
+  // Ensures all queued frames have been written to the output file.
   void FinishFrameData();
 
   std::thread m_frame_dump_thread;
@@ -70,23 +98,21 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
-  // Communication of frame between video and dump threads.
-  FrameData m_frame_dump_data;
-
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+  std::array<FrameDumpSlot, FRAME_DUMP_RING_SIZE> m_frame_dump_slots;
+
+  // Number of frames copied to a readback texture.
+  u64 m_frame_dump_copied = 0;
+  // Number of frames mapped and queued for encoding.
+  u64 m_frame_dump_queued = 0;
+  // Number of frames the frame dump thread is done with.
+  std::atomic<u64> m_frame_dump_encoded = 0;
+
+  // Communication of frames between video and dump threads.
+  Common::SPSCQueue<FrameData> m_frame_dump_queue;
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
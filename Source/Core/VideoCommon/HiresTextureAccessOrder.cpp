@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/HiresTextureAccessOrder.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Common/StringUtil.h"
+
+void HiresTextureAccessOrder::Load(std::string_view saved_order,
+                                   const std::function<bool(const std::string&)>& exists)
+{
+  Clear();
+
+  for (std::string& id : SplitString(std::string(saved_order), '\n'))
+  {
+    // Skip textures that have been removed from the pack since the order was saved.
+    if (id.empty() || !exists(id))
+      continue;
+    if (m_recorded_index.try_emplace(id, m_recorded_order.size()).second)
+      m_recorded_order.push_back(std::move(id));
+  }
+}
+
+std::string HiresTextureAccessOrder::Save() const
+{
+  if (m_order.empty())
+    return "";
+
+  // This run may not have reached all the textures that previous runs used,
+  // so keep the rest of the recorded order after the textures used by this run.
+  std::string contents;
+  for (const std::string& id : m_order)
+    contents += id + '\n';
+  for (const std::string& id : m_recorded_order)
+  {
+    if (!m_accessed.contains(id))
+      contents += id + '\n';
+  }
+  return contents;
+}
+
+void HiresTextureAccessOrder::Clear()
+{
+  m_recorded_order.clear();
+  m_recorded_index.clear();
+  m_prefetch_end = 0;
+  m_order.clear();
+  m_accessed.clear();
+}
+
+std::vector<std::string> HiresTextureAccessOrder::GetInitialPrefetch()
+{
+  return Prefetch(0);
+}
+
+std::vector<std::string> HiresTextureAccessOrder::RecordAccess(const std::string& id)
+{
+  if (!m_accessed.insert(id).second)
+    return {};
+
+  m_order.push_back(id);
+
+  const auto it = m_recorded_index.find(id);
+  if (it == m_recorded_index.end())
+    return {};
+  return Prefetch(it->second);
+}
+
+std::vector<std::string> HiresTextureAccessOrder::Prefetch(size_t index)
+{
+  // When the game skips ahead of the recorded order, the textures it skipped aren't prefetched
+  // anymore, it already got past the point where they would have been needed.
+  const size_t begin = std::max(index, m_prefetch_end);
+  const size_t end = std::min(index + PREFETCH_DISTANCE, m_recorded_order.size());
+  if (begin >= end)
+    return {};
+
+  m_prefetch_end = end;
+  return std::vector<std::string>(m_recorded_order.rbegin() + (m_recorded_order.size() - end),
+                                  m_recorded_order.rbegin() + (m_recorded_order.size() - begin));
+}
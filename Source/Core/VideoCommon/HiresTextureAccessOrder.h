@@ -0,0 +1,49 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Remembers the order in which a game first uses its custom textures, so that the next run can
+// load them shortly before the game needs them.
+class HiresTextureAccessOrder
+{
+public:
+  // Textures are prefetched this many textures ahead of the latest one used by the game.
+  static constexpr size_t PREFETCH_DISTANCE = 64;
+
+  // Reads an order that a previous run saved, skipping the textures for which `exists` is false.
+  void Load(std::string_view saved_order, const std::function<bool(const std::string&)>& exists);
+  // The textures used by this run, followed by those of the loaded order this run didn't reach.
+  // Returns an empty string if this run didn't use any texture.
+  std::string Save() const;
+  void Clear();
+
+  // The textures to prefetch when the game starts.
+  std::vector<std::string> GetInitialPrefetch();
+  // Records that the game used `id`, and returns the textures to prefetch because of it.
+  //
+  // Both return the textures in the order they should be requested in. The asset loader handles
+  // the most recent requests first, so the texture that is needed soonest comes last.
+  std::vector<std::string> RecordAccess(const std::string& id);
+
+private:
+  std::vector<std::string> Prefetch(size_t index);
+
+  // The order loaded from a previous run, and the index of each texture in it.
+  std::vector<std::string> m_recorded_order;
+  std::unordered_map<std::string, size_t> m_recorded_index;
+  // Textures before this index of m_recorded_order have been prefetched or skipped.
+  size_t m_prefetch_end = 0;
+
+  // The order in which this run first uses textures.
+  std::vector<std::string> m_order;
+  std::unordered_set<std::string> m_accessed;
+};
@@ -9,6 +9,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include <xxhash.h>
 
 #include "Common/CommonPaths.h"
@@ -19,6 +20,7 @@
 #include "Core/ConfigManager.h"
 #include "Core/System.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/HiresTextureAccessOrder.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/Resources/CustomResourceManager.h"
 #include "VideoCommon/VideoConfig.h"
@@ -30,8 +32,57 @@ static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 
+// Where the order in which the current game first uses its textures is stored between runs.
+static std::string s_access_order_path;
+static HiresTextureAccessOrder s_access_order;
+
 namespace
 {
+std::string GetAccessOrderPath(const std::vector<std::string>& game_ids)
+{
+  if (game_ids.empty())
+    return "";
+  return File::GetUserPath(D_CACHE_IDX) + "HiresTextures" DIR_SEP + game_ids.front() + ".txt";
+}
+
+void LoadAccessOrder()
+{
+  std::string contents;
+  if (s_access_order_path.empty() || !File::ReadFileToString(s_access_order_path, contents))
+    return;
+
+  s_access_order.Load(contents, [](const std::string& id) {
+    return s_hires_texture_id_to_arbmipmap.contains(id);
+  });
+}
+
+void SaveAccessOrder()
+{
+  const std::string contents = s_access_order.Save();
+  if (s_access_order_path.empty() || contents.empty())
+    return;
+
+  File::CreateFullPath(s_access_order_path);
+  if (!File::WriteStringToFile(s_access_order_path, contents))
+    WARN_LOG_FMT(VIDEO, "Failed to write texture access order to {}", s_access_order_path);
+}
+
+void ResetAccessOrder()
+{
+  s_access_order_path.clear();
+  s_access_order.Clear();
+}
+
+void PrefetchTextures(const std::vector<std::string>& ids)
+{
+  // With the whole pack cached by Update(), there is nothing to prefetch.
+  if (g_ActiveConfig.bCacheHiresTextures)
+    return;
+
+  for (const std::string& id : ids)
+    HiresTexture(s_hires_texture_id_to_arbmipmap[id], id).LoadTexture();
+}
+
 std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 {
   if (s_hires_texture_id_to_arbmipmap.empty())
@@ -83,6 +134,9 @@ void HiresTexture::Update()
     return;
   }
 
+  SaveAccessOrder();
+  ResetAccessOrder();
+
   const std::set<std::string> texture_directories = GetTextureDirectoriesForFirstMatchingGameId(
       File::GetUserPath(D_HIRESTEXTURES_IDX), SConfig::GetInstance().GetGameIDsForTextures());
 
@@ -142,6 +196,13 @@ void HiresTexture::Update()
 
   const std::vector<std::string> game_ids_for_textures =
       SConfig::GetInstance().GetGameIDsForTextures();
+
+  if (!texture_directories.empty())
+  {
+    s_access_order_path = GetAccessOrderPath(game_ids_for_textures);
+    LoadAccessOrder();
+    PrefetchTextures(s_access_order.GetInitialPrefetch());
+  }
   const std::string game_id_display = fmt::format("{}", fmt::join(game_ids_for_textures, "' or '"));
 
   std::string message;
@@ -160,6 +221,9 @@ void HiresTexture::Update()
 
 void HiresTexture::Clear()
 {
+  SaveAccessOrder();
+  ResetAccessOrder();
+
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
@@ -171,6 +235,8 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_in
   if (base_filename == "")
     return nullptr;
 
+  PrefetchTextures(s_access_order.RecordAccess(base_filename));
+
   if (auto iter = s_hires_texture_cache.find(base_filename); iter != s_hires_texture_cache.end())
   {
     return iter->second;
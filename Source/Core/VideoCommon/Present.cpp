@@ -237,7 +237,8 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
     is_duplicate = false;
 #endif
 
-  if (!is_duplicate || !g_ActiveConfig.bSkipPresentingDuplicateXFBs)
+  if ((!is_duplicate || !g_ActiveConfig.bSkipPresentingDuplicateXFBs) &&
+      !m_skip_presentation.load(std::memory_order_relaxed))
   {
     Present(&present_info);
     ProcessFrameDumping(ticks);
@@ -272,6 +273,9 @@ void Presenter::ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_
 
   video_events.before_present_event.Trigger(present_info);
 
+  if (m_skip_presentation.load(std::memory_order_relaxed))
+    return;
+
   Present(&present_info);
   ProcessFrameDumping(ticks);
 
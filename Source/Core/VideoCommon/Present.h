@@ -43,6 +43,13 @@ public:
 
   void SetNextSwapEstimatedTime(u64 ticks, TimePoint host_time);
 
+  // While set, swaps are processed but not presented. Used by NetPlay for the frames it emulates
+  // again after a rollback.
+  void SetSkipPresentation(bool skip)
+  {
+    m_skip_presentation.store(skip, std::memory_order_relaxed);
+  }
+
   void Present(PresentInfo* present_info = nullptr);
   void ClearLastXfbId() { m_last_xfb_id = std::numeric_limits<u64>::max(); }
 
@@ -195,6 +202,8 @@ private:
   TimePoint m_next_swap_estimated_time{Clock::now()};
 
   std::atomic_bool m_immediate_swap_happened_this_field{};
+
+  std::atomic_bool m_skip_presentation{};
 };
 
 }  // namespace VideoCommon
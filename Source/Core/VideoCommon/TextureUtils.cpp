@@ -3,10 +3,15 @@
 
 #include "VideoCommon/TextureUtils.h"
 
+#include <algorithm>
+#include <thread>
+#include <utility>
+
 #include <fmt/format.h>
 
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/Image.h"
 #include "Common/Logging/Log.h"
 
 #include "Core/Config/GraphicsSettings.h"
@@ -47,6 +52,14 @@ void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 lev
   texture.Save(filename, level, Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL));
 }
 
+TextureDumper::TextureDumper() = default;
+
+TextureDumper::~TextureDumper()
+{
+  // Make sure every queued texture is written out.
+  m_workers.clear();
+}
+
 void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
                                 bool is_arbitrary)
 {
@@ -74,7 +87,42 @@ void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string ba
   if (file_existed)
     return;
 
-  texture.Save(fmt::format("{}/{}.png", dump_dir, name), level,
-               Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL));
+  std::vector<u8> data;
+  u32 width, height;
+  if (!texture.ReadbackLevel(level, &data, &width, &height))
+    return;
+
+  QueueSave(fmt::format("{}/{}.png", dump_dir, name), std::move(data), width, height);
+}
+
+void TextureDumper::QueueSave(std::string filename, std::vector<u8> data, u32 width, u32 height)
+{
+  if (m_workers.empty())
+  {
+    const u32 worker_count = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+    for (u32 i = 0; i < worker_count; ++i)
+      m_workers.push_back(std::make_unique<Common::AsyncWorkThreadSP>("Texture dumping"));
+  }
+
+  {
+    // Readbacks are much faster than PNG encoding, don't let them pile up in memory.
+    std::unique_lock lk(m_pending_mutex);
+    m_pending_cv.wait(lk, [this] { return m_pending_saves < MAX_PENDING_SAVES; });
+    ++m_pending_saves;
+  }
+
+  const int compression = Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL);
+  m_workers[m_next_worker]->Push(
+      [this, filename = std::move(filename), data = std::move(data), width, height, compression] {
+        Common::SavePNG(filename, data.data(), Common::ImageByteFormat::RGBA, width, height,
+                        width * 4, compression);
+
+        {
+          std::lock_guard lk(m_pending_mutex);
+          --m_pending_saves;
+        }
+        m_pending_cv.notify_one();
+      });
+  m_next_worker = (m_next_worker + 1) % m_workers.size();
 }
 }  // namespace VideoCommon::TextureUtils
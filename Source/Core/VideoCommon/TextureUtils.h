@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
 class AbstractTexture;
 
@@ -15,12 +20,30 @@ namespace VideoCommon::TextureUtils
 class TextureDumper
 {
 public:
+  TextureDumper();
+  ~TextureDumper();
+
   // Only dumps if texture did not already exist anywhere within the dump-textures path.
+  // The texture is downloaded right away, but encoded and written on a worker thread.
   void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
                    bool is_arbitrary);
 
 private:
+  // The GPU thread waits for the workers when more textures than this are waiting to be saved.
+  static constexpr u32 MAX_PENDING_SAVES = 64;
+
+  void QueueSave(std::string filename, std::vector<u8> data, u32 width, u32 height);
+
+  // Only accessed on the thread calling DumpTexture, textures are de-duplicated before queueing.
   std::unordered_set<std::string> m_dumped_textures;
+
+  std::mutex m_pending_mutex;
+  std::condition_variable m_pending_cv;
+  u32 m_pending_saves = 0;
+
+  // Created on the first dump. Declared last so that the workers finish before the rest is gone.
+  std::vector<std::unique_ptr<Common::AsyncWorkThreadSP>> m_workers;
+  size_t m_next_worker = 0;
 };
 
 void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
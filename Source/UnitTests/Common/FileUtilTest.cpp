@@ -10,6 +10,7 @@
 
 #include "Common/BitUtils.h"
 #include "Common/DirectIOFile.h"
+#include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 
 class FileUtilTest : public testing::Test
@@ -154,6 +155,33 @@ TEST_F(FileUtilTest, CreateFullPath)
   EXPECT_TRUE(File::IsFile(p3file));
 }
 
+TEST_F(FileUtilTest, DoFileSearch)
+{
+  for (const char* name : {"/a/b/c/game.iso", "/a/b/other.txt", "/a/GAME.RVZ", "/d/game.iso",
+                           "/top.iso"})
+  {
+    ASSERT_TRUE(File::CreateFullPath(m_directory_path + name));
+    ASSERT_TRUE(File::CreateEmptyFile(m_directory_path + name));
+  }
+
+  const std::string_view directory = m_directory_path;
+  constexpr std::array<std::string_view, 2> exts = {".iso", ".rvz"};
+
+  const std::vector<std::string> expected = {
+      m_directory_path + "/a/GAME.RVZ",
+      m_directory_path + "/a/b/c/game.iso",
+      m_directory_path + "/d/game.iso",
+      m_directory_path + "/top.iso",
+  };
+  EXPECT_EQ(Common::DoFileSearch(directory, exts, true), expected);
+
+  // Searching with multiple threads gives the same (sorted) result.
+  EXPECT_EQ(Common::DoFileSearch(std::span(&directory, 1), exts, true, 4), expected);
+
+  const std::vector<std::string> expected_top = {m_directory_path + "/top.iso"};
+  EXPECT_EQ(Common::DoFileSearch(std::span(&directory, 1), exts, false, 4), expected_top);
+}
+
 TEST_F(FileUtilTest, DirectIOFile)
 {
   static constexpr std::array<u8, 3> u8_test_data = {42, 7, 99};
@@ -0,0 +1,259 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/Swap.h"
+#include "Core/ActionReplay.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+namespace
+{
+// Data types
+constexpr u32 SIZE_8 = 0;
+constexpr u32 SIZE_16 = 1;
+constexpr u32 SIZE_32 = 2;
+
+// Conditional line counts
+constexpr u32 SKIP_ONE_LINE = 0;
+constexpr u32 SKIP_ALL_LINES_UNTIL = 2;
+
+constexpr u32 TYPE_EQUAL = 1;
+
+const ActionReplay::AREntry END_IF{0x00000000, 0x40000000};
+
+constexpr u32 CmdAddr(u32 subtype, u32 type, u32 size, u32 address)
+{
+  return subtype << 30 | type << 27 | size << 25 | (address & 0x01FFFFFF);
+}
+
+ActionReplay::AREntry RamWrite(u32 size, u32 address, u32 data)
+{
+  return {CmdAddr(0, 0, size, address), data};
+}
+
+ActionReplay::AREntry WriteToPointer(u32 size, u32 address, u32 data)
+{
+  return {CmdAddr(1, 0, size, address), data};
+}
+
+ActionReplay::AREntry IfEqual(u32 line_count, u32 size, u32 address, u32 data)
+{
+  return {CmdAddr(line_count, TYPE_EQUAL, size, address), data};
+}
+
+// The two lines of a fill & slide zero code
+std::pair<ActionReplay::AREntry, ActionReplay::AREntry>
+FillAndSlide(u32 size, u32 address, u32 value, u8 count, s16 address_step, s8 value_step)
+{
+  return {{0x00000000, 0x80000000 | size << 25 | (address & 0x01FFFFFF)},
+          {value, static_cast<u32>(static_cast<u8>(value_step)) << 24 | u32{count} << 16 |
+                      static_cast<u16>(address_step)}};
+}
+
+// The two lines of a memory copy zero code
+std::pair<ActionReplay::AREntry, ActionReplay::AREntry>
+MemoryCopy(u32 destination, u32 source, u32 count, bool with_pointers)
+{
+  return {{0x00000000, 0x86000000 | (destination & 0x01FFFFFF)},
+          {source & 0x01FFFFFF, (with_pointers ? 0x01000000 : 0) | count}};
+}
+
+struct Fixture
+{
+  std::string name;
+  std::vector<ActionReplay::AREntry> ops;
+  // Words written to RAM (in big endian) before the code runs
+  std::vector<std::pair<u32, u32>> memory;
+};
+
+std::vector<ActionReplay::AREntry>
+Lines(std::initializer_list<std::pair<ActionReplay::AREntry, ActionReplay::AREntry>> pairs)
+{
+  std::vector<ActionReplay::AREntry> lines;
+  for (const auto& [first, second] : pairs)
+  {
+    lines.push_back(first);
+    lines.push_back(second);
+  }
+  return lines;
+}
+
+std::vector<Fixture> GetFixtures()
+{
+  std::vector<Fixture> fixtures;
+
+  // A failed one line conditional skips the first line of a zero code, so that its parameter line
+  // runs as a code of its own (here an 8-bit fill of 0x401 bytes at 0x80001100).
+  const auto [fill_header, fill_parameters] =
+      FillAndSlide(SIZE_32, 0x80004000, 0x00001100, 4, 1, 0);
+  for (const u32 condition : {0x12345678u, 0x87654321u})
+  {
+    fixtures.push_back({fmt::format("SkipIntoZeroCodeParameters{:08x}", condition),
+                        {IfEqual(SKIP_ONE_LINE, SIZE_32, 0x80000100, 0x12345678), fill_header,
+                         fill_parameters, RamWrite(SIZE_32, 0x80000200, 0xCAFEBABE)},
+                        {{0x80000100, condition}}});
+  }
+
+  for (const u32 condition : {0x1234u, 0x4321u})
+  {
+    fixtures.push_back({fmt::format("SkipAllLinesUntil{:04x}", condition),
+                        {IfEqual(SKIP_ALL_LINES_UNTIL, SIZE_16, 0x80000100, 0x1234),
+                         RamWrite(SIZE_32, 0x80000200, 0x11111111),
+                         RamWrite(SIZE_16, 0x80000210, 0x00032222), END_IF,
+                         RamWrite(SIZE_8, 0x80000220, 0x00000533)},
+                        {{0x80000100, condition << 16}}});
+  }
+
+  fixtures.push_back({"FillAndSlide",
+                      Lines({FillAndSlide(SIZE_8, 0x80000300, 0x000000F0, 0x20, 3, 7),
+                             FillAndSlide(SIZE_16, 0x80000800, 0x00001000, 0x10, -3, -1),
+                             FillAndSlide(SIZE_32, 0x80000C00, 0x7FFFFFF0, 0x18, 2, 5)}),
+                      {}});
+
+  fixtures.push_back({"MemoryCopy",
+                      Lines({MemoryCopy(0x80001000, 0x80000100, 0x40, false),
+                             // Only the low byte of the count is used
+                             MemoryCopy(0x80001200, 0x80000100, 0x0121, false)}),
+                      {{0x80000100, 0x01020304},
+                       {0x80000104, 0x05060708},
+                       {0x80000120, 0xDEADBEEF},
+                       {0x8000013C, 0xFFEEDDCC}}});
+
+  fixtures.push_back({"MemoryCopyWithPointers",
+                      Lines({MemoryCopy(0x80000010, 0x80000014, 0x30, true)}),
+                      {{0x80000010, 0x80002000},
+                       {0x80000014, 0x80000100},
+                       {0x80000100, 0x01020304},
+                       {0x8000012C, 0xA5A5A5A5}}});
+
+  fixtures.push_back({"WriteToPointer",
+                      {WriteToPointer(SIZE_8, 0x80000010, 0x000123AB),
+                       WriteToPointer(SIZE_16, 0x80000014, 0x0007BEEF),
+                       WriteToPointer(SIZE_32, 0x80000018, 0x76543210),
+                       // A null pointer isn't in RAM, so nothing is written
+                       WriteToPointer(SIZE_32, 0x8000001C, 0x55555555)},
+                      {{0x80000010, 0x80002000},
+                       {0x80000014, 0x80002400},
+                       {0x80000018, 0x80002800},
+                       {0x8000001C, 0x00000000}}});
+
+  return fixtures;
+}
+}  // namespace
+
+class ActionReplayTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_profile_path = File::CreateTempDir();
+    ASSERT_FALSE(m_profile_path.empty());
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    Config::SetCurrent(Config::MAIN_ENABLE_CHEATS, true);
+
+    auto& system = Core::System::GetInstance();
+    Core::DeclareAsCPUThread();
+    system.GetMemory().Init();
+    system.GetPowerPC().Reset();
+
+    // Map 0x80000000 to MEM1 like the IPL does, so that codes can use the direct RAM accesses.
+    auto& ppc_state = system.GetPPCState();
+    ppc_state.spr[SPR_DBAT0U] = 0x80001fff;
+    ppc_state.spr[SPR_DBAT0L] = 0x00000002;
+    system.GetMMU().DBATUpdated();
+    ppc_state.msr.DR = 1;
+    system.GetPowerPC().MSRUpdated();
+  }
+
+  void TearDown() override
+  {
+    ActionReplay::ApplyAndReturnCodes({});
+
+    auto& system = Core::System::GetInstance();
+    system.GetMemory().Shutdown();
+    Core::UndeclareAsCPUThread();
+
+    SConfig::Shutdown();
+    Config::Shutdown();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+
+  static void ResetMemory(const Fixture& fixture)
+  {
+    auto& memory = Core::System::GetInstance().GetMemory();
+    std::memset(memory.GetRAM(), 0, memory.GetRamSizeReal());
+    for (const auto& [address, value] : fixture.memory)
+    {
+      const u32 big_endian = Common::swap32(value);
+      std::memcpy(memory.GetRAM() + (address & 0x01FFFFFF), &big_endian, sizeof(big_endian));
+    }
+  }
+
+  static std::vector<u8> CopyMemory()
+  {
+    auto& memory = Core::System::GetInstance().GetMemory();
+    return {memory.GetRAM(), memory.GetRAM() + memory.GetRamSizeReal()};
+  }
+
+private:
+  std::string m_profile_path;
+};
+
+// The first run after the codes change goes through the interpreter, and the following ones run
+// the compiled codes. Both have to leave guest memory in the same state.
+TEST_F(ActionReplayTest, CompiledCodesMatchInterpreter)
+{
+  for (const Fixture& fixture : GetFixtures())
+  {
+    SCOPED_TRACE(fixture.name);
+
+    ActionReplay::ARCode code;
+    code.name = fixture.name;
+    code.ops = fixture.ops;
+    code.enabled = true;
+    ActionReplay::ApplyAndReturnCodes(std::span(&code, 1));
+
+    const Core::CPUThreadGuard guard(Core::System::GetInstance());
+
+    ResetMemory(fixture);
+    const std::vector<u8> initial = CopyMemory();
+    ActionReplay::RunAllActive(guard);
+    const std::vector<u8> interpreted = CopyMemory();
+    ASSERT_EQ(1u, ActionReplay::CountEnabledCodes());
+    EXPECT_NE(initial, interpreted);
+
+    ResetMemory(fixture);
+    ActionReplay::RunAllActive(guard);
+    const std::vector<u8> compiled = CopyMemory();
+    ASSERT_EQ(1u, ActionReplay::CountEnabledCodes());
+
+    const auto [interpreted_it, compiled_it] = std::ranges::mismatch(interpreted, compiled);
+    EXPECT_EQ(interpreted_it, interpreted.end())
+        << fmt::format("First difference at {:#010x}: interpreted {:02x}, compiled {:02x}",
+                       0x80000000 + (interpreted_it - interpreted.begin()), *interpreted_it,
+                       *compiled_it);
+  }
+}
@@ -0,0 +1,98 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <atomic>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceMixer.h"
+
+using DSP::HLE::AXVoiceMixer;
+
+namespace
+{
+constexpr size_t BUFFER_SIZE = 96;
+constexpr size_t SMALL_BUFFER_SIZE = 18;
+constexpr size_t BUFFER_COUNT = 3;
+
+struct Voice
+{
+  std::array<s16, BUFFER_SIZE> samples;
+};
+
+std::vector<Voice> RandomVoices(size_t count)
+{
+  std::mt19937 rng(static_cast<u32>(count));
+  std::uniform_int_distribution<int> dist(-0x8000, 0x7FFF);
+  std::vector<Voice> voices(count);
+  for (Voice& voice : voices)
+  {
+    for (s16& sample : voice.samples)
+      sample = static_cast<s16>(dist(rng));
+  }
+  return voices;
+}
+
+using Output = std::array<std::vector<int>, BUFFER_COUNT>;
+
+Output MixWithThreads(u32 thread_count, const std::vector<Voice>& voices)
+{
+  Output output{std::vector<int>(BUFFER_SIZE, 1), std::vector<int>(BUFFER_SIZE, 2),
+                std::vector<int>(SMALL_BUFFER_SIZE, 3)};
+  const std::array<std::span<int>, BUFFER_COUNT> spans{output[0], output[1], output[2]};
+
+  std::vector<std::atomic<int>> mix_count(voices.size());
+  AXVoiceMixer mixer(thread_count);
+  mixer.Mix(voices.size(), spans,
+            [&](u32 thread, size_t begin, size_t end, std::span<int* const> buffers) {
+              EXPECT_LT(thread, mixer.GetThreadCountFor(voices.size()));
+              EXPECT_EQ(buffers.size(), BUFFER_COUNT);
+              for (size_t i = begin; i < end; ++i)
+              {
+                ++mix_count[i];
+                for (size_t j = 0; j < BUFFER_SIZE; ++j)
+                {
+                  buffers[0][j] += voices[i].samples[j];
+                  buffers[1][j] -= voices[i].samples[j] >> 1;
+                }
+                for (size_t j = 0; j < SMALL_BUFFER_SIZE; ++j)
+                  buffers[2][j] += voices[i].samples[j * 5];
+              }
+            });
+
+  for (const auto& count : mix_count)
+    EXPECT_EQ(count, 1);
+  return output;
+}
+}  // namespace
+
+TEST(AXVoiceMixer, ThreadCountFor)
+{
+  const AXVoiceMixer mixer(4);
+  EXPECT_EQ(mixer.GetThreadCount(), 4u);
+  EXPECT_EQ(mixer.GetThreadCountFor(0), 1u);
+  EXPECT_EQ(mixer.GetThreadCountFor(AXVoiceMixer::MIN_VOICES_PER_THREAD * 2), 2u);
+  EXPECT_EQ(mixer.GetThreadCountFor(96), 4u);
+
+  EXPECT_EQ(AXVoiceMixer(0).GetThreadCount(), 1u);
+  EXPECT_EQ(AXVoiceMixer(1000).GetThreadCount(), AXVoiceMixer::MAX_THREADS);
+}
+
+TEST(AXVoiceMixer, SameOutputForAnyThreadCount)
+{
+  for (size_t voice_count : {size_t(0), size_t(5), size_t(17), size_t(64), size_t(96)})
+  {
+    const std::vector<Voice> voices = RandomVoices(voice_count);
+    const Output expected = MixWithThreads(1, voices);
+    for (u32 thread_count : {2u, 3u, 4u, 7u})
+    {
+      EXPECT_EQ(expected, MixWithThreads(thread_count, voices))
+          << "voices=" << voice_count << " threads=" << thread_count;
+    }
+  }
+}
@@ -0,0 +1,94 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/ZeldaMixing.h"
+
+namespace ZeldaMixing = DSP::HLE::ZeldaMixing;
+
+namespace
+{
+// One more than a mixing buffer so that the scalar tail of the vectorized code is covered.
+constexpr size_t BUFFER_SIZE = 0x51;
+using Buffer = std::array<s16, BUFFER_SIZE>;
+
+Buffer RandomBuffer(std::mt19937& rng)
+{
+  std::uniform_int_distribution<int> dist(-0x8000, 0x7FFF);
+  Buffer buf;
+  for (s16& sample : buf)
+    sample = static_cast<s16>(dist(rng));
+  // Make sure the extremes are always present.
+  buf[0] = -0x8000;
+  buf[1] = 0x7FFF;
+  return buf;
+}
+}  // namespace
+
+TEST(ZeldaMixing, ApplyVolumeInPlace)
+{
+  std::mt19937 rng(0);
+  for (u16 vol : {0x0000, 0x0001, 0x4000, 0x6784, 0x7FFF, 0x8000, 0xC000, 0xFFFF})
+  {
+    for (u32 shift : {12u, 15u})
+    {
+      Buffer expected = RandomBuffer(rng);
+      Buffer actual = expected;
+      ZeldaMixing::Generic::ApplyVolumeInPlace(expected.data(), expected.size(), vol, shift);
+      ZeldaMixing::ApplyVolumeInPlace(actual.data(), actual.size(), vol, shift);
+      EXPECT_EQ(expected, actual) << "vol=" << vol << " shift=" << shift;
+    }
+  }
+}
+
+TEST(ZeldaMixing, AddBuffersWithVolumeRamp)
+{
+  std::mt19937 rng(1);
+  const std::array<std::pair<s32, s32>, 7> ramps{{
+      {0, 0},
+      {0, 0x1000},
+      {0x7FFF0000, 0},
+      {0x7FFF0000, -0x30000},
+      {std::numeric_limits<s32>::min(), 0x12345},
+      {0x40000000, 0x7FFFFFF},
+      {0x12345678, -0x5432100},
+  }};
+
+  for (const auto& [vol, step] : ramps)
+  {
+    Buffer expected = RandomBuffer(rng);
+    Buffer actual = expected;
+    const Buffer src = RandomBuffer(rng);
+    const s32 expected_vol = ZeldaMixing::Generic::AddBuffersWithVolumeRamp(
+        expected.data(), src.data(), src.size(), vol, step);
+    const s32 actual_vol =
+        ZeldaMixing::AddBuffersWithVolumeRamp(actual.data(), src.data(), src.size(), vol, step);
+    EXPECT_EQ(expected, actual) << "vol=" << vol << " step=" << step;
+    EXPECT_EQ(expected_vol, actual_vol) << "vol=" << vol << " step=" << step;
+  }
+}
+
+TEST(ZeldaMixing, AddBuffersWithVolume)
+{
+  std::mt19937 rng(2);
+  for (u16 vol : {0x0000, 0x0001, 0x4000, 0x7FFF, 0x8000, 0xB000, 0xFFFF})
+  {
+    // Partial buffers are mixed too, see the reverb code in Zelda.cpp.
+    for (size_t count : {BUFFER_SIZE, size_t(0x28), size_t(3)})
+    {
+      Buffer expected = RandomBuffer(rng);
+      Buffer actual = expected;
+      const Buffer src = RandomBuffer(rng);
+      ZeldaMixing::Generic::AddBuffersWithVolume(expected.data(), src.data(), count, vol);
+      ZeldaMixing::AddBuffersWithVolume(actual.data(), src.data(), count, vol);
+      EXPECT_EQ(expected, actual) << "vol=" << vol << " count=" << count;
+    }
+  }
+}
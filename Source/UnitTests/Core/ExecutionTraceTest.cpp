@@ -0,0 +1,118 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <zstd.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Core/Debugger/ExecutionTrace.h"
+
+using Core::ExecutionTrace;
+using Core::ExecutionTraceRecord;
+using Core::ExecutionTraceRecordType;
+
+namespace
+{
+ExecutionTraceRecordType GetExpectedType(u64 index)
+{
+  return static_cast<ExecutionTraceRecordType>(index % 3);
+}
+
+std::vector<ExecutionTraceRecord> ReadTrace(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  Core::ExecutionTraceFileHeader header{};
+  EXPECT_TRUE(file.ReadArray(&header, 1));
+  EXPECT_EQ(Core::ExecutionTraceFileHeader::MAGIC, header.magic);
+  EXPECT_EQ(Core::ExecutionTraceFileHeader::VERSION, header.version);
+
+  std::vector<ExecutionTraceRecord> records;
+  Core::ExecutionTraceChunkHeader chunk_header;
+  while (file.ReadArray(&chunk_header, 1))
+  {
+    EXPECT_LE(chunk_header.record_count, ExecutionTrace::CHUNK_RECORDS);
+
+    std::vector<u8> compressed(chunk_header.compressed_size);
+    EXPECT_TRUE(file.ReadBytes(compressed.data(), compressed.size()));
+
+    const size_t offset = records.size();
+    records.resize(offset + chunk_header.record_count);
+    const size_t size = chunk_header.record_count * sizeof(ExecutionTraceRecord);
+    EXPECT_EQ(size, ZSTD_decompress(&records[offset], size, compressed.data(), compressed.size()));
+  }
+  return records;
+}
+}  // namespace
+
+TEST(ExecutionTrace, RecordsSurviveRingBufferWraparound)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  const std::string path = directory + "/trace.dtrace";
+
+  // Wraps around the ring buffer twice and ends with a partial chunk, which is written when the
+  // recording stops.
+  constexpr u64 RECORD_COUNT =
+      ExecutionTrace::RING_BUFFER_RECORDS * 2 + ExecutionTrace::CHUNK_RECORDS / 2;
+
+  {
+    ExecutionTrace trace;
+    ASSERT_TRUE(trace.Open(path, true));
+    EXPECT_TRUE(trace.GetRecordingActive());
+    EXPECT_TRUE(trace.GetRecordingMemoryAccesses());
+
+    for (u64 i = 0; i < RECORD_COUNT; ++i)
+    {
+      switch (GetExpectedType(i))
+      {
+      case ExecutionTraceRecordType::BlockEntry:
+        ExecutionTrace::RecordBlockEntry(&trace, static_cast<u32>(i));
+        break;
+      case ExecutionTraceRecordType::Load:
+        ExecutionTrace::RecordLoad(&trace, static_cast<u32>(i));
+        break;
+      case ExecutionTraceRecordType::Store:
+        ExecutionTrace::RecordStore(&trace, static_cast<u32>(i));
+        break;
+      }
+    }
+
+    trace.Shutdown();
+    EXPECT_FALSE(trace.GetRecordingActive());
+  }
+
+  const std::vector<ExecutionTraceRecord> records = ReadTrace(path);
+  ASSERT_EQ(RECORD_COUNT, records.size());
+  for (u64 i = 0; i < RECORD_COUNT; ++i)
+  {
+    ASSERT_EQ(GetExpectedType(i), records[i].type) << i;
+    ASSERT_EQ(static_cast<u32>(i), records[i].address) << i;
+  }
+
+  File::DeleteDirRecursively(directory);
+}
+
+TEST(ExecutionTrace, EmptyTraceOnlyHasHeader)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  const std::string path = directory + "/trace.dtrace";
+
+  {
+    ExecutionTrace trace;
+    ASSERT_TRUE(trace.Open(path, false));
+    EXPECT_FALSE(trace.GetRecordingMemoryAccesses());
+    // A second recording can't be started while one is active.
+    EXPECT_FALSE(trace.Open(path, false));
+  }
+
+  EXPECT_TRUE(ReadTrace(path).empty());
+  EXPECT_EQ(sizeof(Core::ExecutionTraceFileHeader), File::GetSize(path));
+
+  File::DeleteDirRecursively(directory);
+}
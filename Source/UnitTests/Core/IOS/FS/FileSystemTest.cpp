@@ -272,6 +272,69 @@ TEST_F(FileSystemTest, GetDirectoryStats)
   check_stats(1u, 2u);
 }
 
+// Stats are cached, so make sure that they are updated when a subdirectory or parent changes.
+TEST_F(FileSystemTest, GetDirectoryStatsAfterModification)
+{
+  const auto get_inodes = [this](const std::string& path) {
+    const Result<DirectoryStats> stats = m_fs->GetDirectoryStats(path);
+    return stats.has_value() ? stats->used_inodes : 0u;
+  };
+
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/tmp/1", 0, modes), ResultCode::Success);
+  const u32 root_inodes = get_inodes("/");
+  EXPECT_EQ(get_inodes("/tmp"), 2u);
+  EXPECT_EQ(get_inodes("/tmp/1"), 1u);
+
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/1/f", 0, modes), ResultCode::Success);
+  EXPECT_EQ(get_inodes("/"), root_inodes + 1);
+  EXPECT_EQ(get_inodes("/tmp"), 3u);
+  EXPECT_EQ(get_inodes("/tmp/1"), 2u);
+
+  ASSERT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/tmp/1", "/tmp/2"), ResultCode::Success);
+  EXPECT_EQ(m_fs->GetDirectoryStats("/tmp/1").error(), ResultCode::NotFound);
+  EXPECT_EQ(get_inodes("/tmp/2"), 2u);
+
+  ASSERT_EQ(m_fs->Delete(Uid{0}, Gid{0}, "/tmp"), ResultCode::Success);
+  EXPECT_EQ(m_fs->GetDirectoryStats("/tmp/2").error(), ResultCode::NotFound);
+  EXPECT_EQ(get_inodes("/"), root_inodes - 2);
+}
+
+// Cached stats are updated in place, so they have to track file sizes across writes.
+TEST_F(FileSystemTest, GetDirectoryStatsAfterWrite)
+{
+  const auto get_clusters = [this](const std::string& path) {
+    const Result<DirectoryStats> stats = m_fs->GetDirectoryStats(path);
+    return stats.has_value() ? stats->used_clusters : 0u;
+  };
+
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/tmp/1", 0, modes), ResultCode::Success);
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/1/f", 0, modes), ResultCode::Success);
+  const u32 root_clusters = get_clusters("/");
+  EXPECT_EQ(get_clusters("/tmp/1"), 0u);
+
+  {
+    const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/1/f", Mode::Write);
+    ASSERT_TRUE(file.has_value());
+    const std::vector<u8> data(CLUSTER_SIZE + 1);
+    ASSERT_TRUE(file->Write(data.data(), data.size()).has_value());
+    EXPECT_EQ(get_clusters("/tmp/1"), 2u);
+    EXPECT_EQ(get_clusters("/"), root_clusters + 2);
+
+    // Overwriting the start of the file doesn't change its size.
+    ASSERT_TRUE(file->Seek(0, SeekMode::Set).has_value());
+    ASSERT_TRUE(file->Write(data.data(), 10).has_value());
+    EXPECT_EQ(get_clusters("/tmp/1"), 2u);
+  }
+
+  ASSERT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/tmp/1", "/tmp/2"), ResultCode::Success);
+  EXPECT_EQ(get_clusters("/tmp/2"), 2u);
+  EXPECT_EQ(get_clusters("/"), root_clusters + 2);
+
+  ASSERT_EQ(m_fs->Delete(Uid{0}, Gid{0}, "/tmp/2/f"), ResultCode::Success);
+  EXPECT_EQ(get_clusters("/tmp/2"), 0u);
+  EXPECT_EQ(get_clusters("/"), root_clusters);
+}
+
 // Files need to be explicitly created using CreateFile or CreateDirectory.
 // Automatically creating them on first use would be a bug.
 TEST_F(FileSystemTest, NonExistingFiles)
@@ -0,0 +1,257 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <deque>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/NetPlayRollback.h"
+#include "InputCommon/GCPadStatus.h"
+
+using namespace NetPlay::Rollback;
+
+namespace
+{
+GCPadStatus MakeStatus(u16 button)
+{
+  GCPadStatus status;
+  status.button = button;
+  return status;
+}
+
+GCPadStatus GetPlayerInput(int player, u64 frame)
+{
+  return MakeStatus(player == 0 ? static_cast<u16>(frame / 5 % 3) :
+                                  static_cast<u16>(frame / 7 % 4 << 4));
+}
+
+// Stands in for the emulated game: each frame mixes the inputs it polled into a checksum, so any
+// frame that kept a mispredicted input ends up with a different checksum.
+struct Game
+{
+  u64 frames = 0;
+  u64 checksum = 0;
+
+  void EmulateFrame(const GCPadStatus& first, const GCPadStatus& second)
+  {
+    checksum = (checksum * 31 + first.button) * 31 + second.button;
+    ++frames;
+  }
+};
+
+struct Peer
+{
+  int local_pad = 0;
+  Game game;
+  std::map<u64, Game> states;
+  Session session;
+  std::map<u64, u64> checksums;
+  bool waiting_for_inputs = false;
+  u32 resimulated_frames = 0;
+};
+}  // namespace
+
+TEST(NetPlayRollback, ConfirmedInputIsReturned)
+{
+  InputHistory history;
+  EXPECT_FALSE(history.Confirm(0, MakeStatus(1)));
+  EXPECT_FALSE(history.Confirm(1, MakeStatus(2)));
+  EXPECT_EQ(history.GetFirstUnconfirmedFrame(), 2u);
+  EXPECT_EQ(history.GetInput(0).button, 1);
+  EXPECT_EQ(history.GetInput(1).button, 2);
+}
+
+TEST(NetPlayRollback, PredictionRepeatsLastInput)
+{
+  InputHistory history;
+  EXPECT_FALSE(history.Confirm(0, MakeStatus(1)));
+  EXPECT_EQ(history.GetInput(3).button, 1);
+
+  // Predictions that turn out right don't need a rollback.
+  EXPECT_FALSE(history.Confirm(1, MakeStatus(1)));
+  EXPECT_FALSE(history.Confirm(2, MakeStatus(1)));
+  EXPECT_FALSE(history.Confirm(3, MakeStatus(1)));
+}
+
+TEST(NetPlayRollback, MispredictionIsReported)
+{
+  InputHistory history;
+  for (u64 frame = 0; frame < 4; ++frame)
+    EXPECT_EQ(history.GetInput(frame).button, 0);
+
+  EXPECT_FALSE(history.Confirm(0, MakeStatus(0)));
+  EXPECT_TRUE(history.Confirm(1, MakeStatus(5)));
+
+  // The frames after the rollback are predicted from the corrected input.
+  EXPECT_EQ(history.GetInput(2).button, 5);
+  EXPECT_EQ(history.GetInput(3).button, 5);
+  EXPECT_FALSE(history.Confirm(2, MakeStatus(5)));
+  EXPECT_TRUE(history.Confirm(3, MakeStatus(0)));
+}
+
+TEST(NetPlayRollback, RollbackWindow)
+{
+  InputHistory history;
+  EXPECT_TRUE(history.CanGetInput(MAX_ROLLBACK_FRAMES - 1));
+  EXPECT_FALSE(history.CanGetInput(MAX_ROLLBACK_FRAMES));
+  EXPECT_FALSE(history.Confirm(0, MakeStatus(0)));
+  EXPECT_TRUE(history.CanGetInput(MAX_ROLLBACK_FRAMES));
+}
+
+// Simulates a remote player whose inputs arrive with a fixed delay, like a loopback connection
+// with artificial latency, and checks that exactly the changed inputs cause rollbacks and that the
+// resimulated frames end up seeing the real inputs.
+TEST(NetPlayRollback, DelayedRemoteInputs)
+{
+  constexpr u64 FRAME_COUNT = 200;
+
+  for (u32 delay = 0; delay < MAX_ROLLBACK_FRAMES; ++delay)
+  {
+    std::vector<GCPadStatus> remote_inputs;
+    u32 expected_rollbacks = 0;
+    for (u64 frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+      remote_inputs.push_back(MakeStatus(static_cast<u16>(frame / 7)));
+      if (frame > 0 && remote_inputs[frame].button != remote_inputs[frame - 1].button)
+        ++expected_rollbacks;
+    }
+
+    InputHistory history;
+    std::vector<u16> simulated(FRAME_COUNT);
+    std::deque<std::pair<u64, GCPadStatus>> in_flight;
+    u32 rollbacks = 0;
+
+    for (u64 frame = 0; frame < FRAME_COUNT + delay; ++frame)
+    {
+      if (frame < FRAME_COUNT)
+        in_flight.emplace_back(frame, remote_inputs[frame]);
+
+      std::optional<u64> rollback_frame;
+      while (!in_flight.empty() && in_flight.front().first + delay <= frame)
+      {
+        const auto [input_frame, status] = in_flight.front();
+        in_flight.pop_front();
+        if (history.Confirm(input_frame, status) && !rollback_frame)
+          rollback_frame = input_frame;
+      }
+
+      const u64 first_frame = rollback_frame ? *rollback_frame : frame;
+      rollbacks += rollback_frame.has_value();
+      for (u64 i = first_frame; i <= frame && i < FRAME_COUNT; ++i)
+      {
+        ASSERT_TRUE(history.CanGetInput(i));
+        simulated[i] = history.GetInput(i).button;
+      }
+    }
+
+    EXPECT_EQ(rollbacks, delay == 0 ? 0 : expected_rollbacks) << "delay=" << delay;
+    for (u64 frame = 0; frame < FRAME_COUNT; ++frame)
+      EXPECT_EQ(simulated[frame], remote_inputs[frame].button) << "frame=" << frame;
+  }
+}
+
+// Two peers, each with its own session, exchange their inputs with some latency. This drives
+// mispredictions and resimulations through Session, with states saved and loaded like the
+// NetPlay client does, and checks that both end up with the frames a lockstep run would produce.
+TEST(NetPlayRollback, SessionResimulatesMispredictedFrames)
+{
+  constexpr u64 FRAME_COUNT = 120;
+  constexpr u64 TICK_COUNT = FRAME_COUNT * 4;
+
+  std::vector<u64> expected_checksums;
+  {
+    Game game;
+    for (u64 frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+      game.EmulateFrame(GetPlayerInput(0, frame), GetPlayerInput(1, frame));
+      expected_checksums.push_back(game.checksum);
+    }
+  }
+
+  for (u32 latency = 0; latency < MAX_ROLLBACK_FRAMES; ++latency)
+  {
+    std::array<Peer, 2> peers;
+    for (int i = 0; i < 2; ++i)
+    {
+      Peer& peer = peers[i];
+      peer.local_pad = i;
+      std::array<PadSource, 4> sources{};
+      sources[i] = PadSource::Local;
+      sources[1 - i] = PadSource::Remote;
+      peer.session.Start(
+          sources,
+          [&peer](u64 frame) {
+            peer.states[frame] = peer.game;
+            return true;
+          },
+          [&peer](u64 frame) {
+            const auto it = peer.states.find(frame);
+            if (it == peer.states.end())
+              return false;
+            peer.game = it->second;
+            return true;
+          });
+    }
+
+    // Inputs sent to each peer, with the tick they arrive at.
+    std::array<std::deque<std::pair<u64, GCPadStatus>>, 2> in_flight;
+
+    for (u64 tick = 0; tick < TICK_COUNT; ++tick)
+    {
+      for (int i = 0; i < 2; ++i)
+      {
+        while (!in_flight[i].empty() && in_flight[i].front().first <= tick)
+        {
+          peers[i].session.AddRemoteInput(1 - i, in_flight[i].front().second);
+          in_flight[i].pop_front();
+        }
+      }
+
+      for (int i = 0; i < 2; ++i)
+      {
+        Peer& peer = peers[i];
+        const u64 frame = peer.game.frames;
+
+        // This is what the VI poll of the first pad does.
+        if (!peer.waiting_for_inputs)
+        {
+          if (peer.session.BeginFrame())
+          {
+            const GCPadStatus status = GetPlayerInput(peer.local_pad, frame);
+            peer.session.AddLocalInput(peer.local_pad, status);
+            in_flight[1 - i].emplace_back(tick + latency + 1, status);
+          }
+          peer.waiting_for_inputs = true;
+        }
+
+        if (!peer.session.CanGetInputs())
+          continue;
+
+        peer.waiting_for_inputs = false;
+        peer.resimulated_frames += peer.session.IsResimulating();
+        peer.game.EmulateFrame(peer.session.GetInput(0), peer.session.GetInput(1));
+        peer.checksums[frame] = peer.game.checksum;
+
+        peer.session.OnSafePoint();
+      }
+    }
+
+    for (const Peer& peer : peers)
+    {
+      ASSERT_GE(peer.game.frames, FRAME_COUNT + MAX_ROLLBACK_FRAMES) << "latency=" << latency;
+      EXPECT_GT(peer.session.GetRollbackCount(), 0u) << "latency=" << latency;
+      EXPECT_GT(peer.resimulated_frames, 0u) << "latency=" << latency;
+      for (u64 frame = 0; frame < FRAME_COUNT; ++frame)
+      {
+        EXPECT_EQ(peer.checksums.at(frame), expected_checksums[frame])
+            << "latency=" << latency << " frame=" << frame;
+      }
+    }
+  }
+}
@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "Core/PowerPC/Expression.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace
+{
+double Evaluate(std::string_view text)
+{
+  const std::optional<Expression> expression = Expression::TryParse(text);
+  EXPECT_TRUE(expression.has_value()) << text;
+  if (!expression)
+    return 0;
+  return expression->Evaluate(Core::System::GetInstance());
+}
+}  // namespace
+
+TEST(Expression, Arithmetic)
+{
+  EXPECT_EQ(Evaluate("1 + 2 * 3"), 7);
+  EXPECT_EQ(Evaluate("(1 + 2) * 3"), 9);
+  EXPECT_EQ(Evaluate("7 % 4"), 3);
+  EXPECT_EQ(Evaluate("2 ** 10"), 1024);
+  EXPECT_EQ(Evaluate("-5 + 2"), -3);
+  EXPECT_EQ(Evaluate("1 << 4 | 1"), 17);
+  EXPECT_EQ(Evaluate("~0"), -1);
+  EXPECT_EQ(Evaluate("!3"), 0);
+  EXPECT_EQ(Evaluate("3 >= 3"), 1);
+}
+
+TEST(Expression, LogicalOperators)
+{
+  EXPECT_EQ(Evaluate("0 && 5"), 0);
+  EXPECT_EQ(Evaluate("3 && 5"), 5);
+  EXPECT_EQ(Evaluate("3 && 0"), 0);
+  EXPECT_EQ(Evaluate("0 || 7"), 7);
+  EXPECT_EQ(Evaluate("4 || 7"), 4);
+  EXPECT_EQ(Evaluate("0 || 0"), 0);
+  EXPECT_EQ(Evaluate("1 && 2 || 3"), 2);
+}
+
+TEST(Expression, Registers)
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  ppc_state.gpr[3] = 16;
+  ppc_state.gpr[4] = 4;
+  ppc_state.gpr[6] = 0xFFFFFFFF;
+
+  EXPECT_EQ(Evaluate("r3 == 16"), 1);
+  EXPECT_EQ(Evaluate("r3 + r4 * 2"), 24);
+  EXPECT_EQ(Evaluate("unbound + 1"), 1);
+
+  EXPECT_EQ(Evaluate("r5 = r3 + 1, r5 * 2"), 34);
+  EXPECT_EQ(ppc_state.gpr[5], 17u);
+
+  // Registers that are only read are left alone.
+  EXPECT_EQ(Evaluate("r6 > 0"), 1);
+  EXPECT_EQ(ppc_state.gpr[6], 0xFFFFFFFFu);
+}
+
+TEST(Expression, Functions)
+{
+  EXPECT_EQ(Evaluate("s16(0xFFFF)"), -1);
+  EXPECT_EQ(Evaluate("u8(0x1234) + 1"), 0x35);
+  EXPECT_EQ(Evaluate("s32(0x80000000) < 0 && u32(0x80000000) > 0"), 1);
+  EXPECT_EQ(Evaluate("streq(\"abc\", \"abc\")"), 1);
+  EXPECT_EQ(Evaluate("streq(\"abc\", \"abd\")"), 0);
+}
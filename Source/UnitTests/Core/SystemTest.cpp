@@ -0,0 +1,96 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+namespace
+{
+constexpr int EVENTS_PER_INSTANCE = 1000;
+
+// userdata points to the counter of the instance the event was scheduled on.
+void CountingCallback(Core::System& system, u64 userdata, s64 lateness)
+{
+  EXPECT_EQ(0, lateness);
+  ++*reinterpret_cast<int*>(userdata);
+}
+}  // namespace
+
+TEST(System, AdditionalInstanceIsSeparate)
+{
+  const std::unique_ptr<Core::System> system = Core::System::CreateInstance();
+  EXPECT_NE(&Core::System::GetInstance(), system.get());
+  EXPECT_NE(&Core::System::GetInstance().GetCoreTiming(), &system->GetCoreTiming());
+  EXPECT_NE(&Core::System::GetInstance().GetMemory(), &system->GetMemory());
+}
+
+TEST(System, TwoInstancesAdvanceIndependently)
+{
+  const std::string profile_path = File::CreateTempDir();
+  ASSERT_FALSE(profile_path.empty());
+  UICommon::SetUserDirectory(profile_path);
+  Config::Init();
+  SConfig::Init();
+
+  {
+    std::array<std::unique_ptr<Core::System>, 2> systems{Core::System::CreateInstance(),
+                                                         Core::System::CreateInstance()};
+    std::array<CoreTiming::EventType*, 2> events{};
+    std::array<int, 2> counts{};
+
+    // Config callbacks and the CPU thread are process-wide, so both instances are emulated on
+    // this thread, through explicit references rather than GetInstance().
+    Core::DeclareAsCPUThread();
+    for (size_t i = 0; i < systems.size(); ++i)
+    {
+      systems[i]->GetPowerPC().Init(PowerPC::CPUCore::Interpreter);
+      systems[i]->GetCoreTiming().Init();
+      events[i] = systems[i]->GetCoreTiming().RegisterEvent("counter", CountingCallback);
+      systems[i]->GetCoreTiming().Advance();
+    }
+
+    for (int n = 0; n < EVENTS_PER_INSTANCE * 2; ++n)
+    {
+      for (size_t i = 0; i < systems.size(); ++i)
+      {
+        // The second instance gets an event on every step, the first one on every other step.
+        if (i == 0 && n % 2 != 0)
+          continue;
+
+        Core::System& system = *systems[i];
+        system.GetCoreTiming().ScheduleEvent(100, events[i], reinterpret_cast<u64>(&counts[i]));
+        system.GetPPCState().downcount = 0;  // Pretend the CPU ran up to the event.
+        system.GetCoreTiming().Advance();
+      }
+    }
+
+    EXPECT_EQ(EVENTS_PER_INSTANCE, counts[0]);
+    EXPECT_EQ(EVENTS_PER_INSTANCE * 2, counts[1]);
+    EXPECT_LT(systems[0]->GetCoreTiming().GetTicks(), systems[1]->GetCoreTiming().GetTicks());
+
+    for (std::unique_ptr<Core::System>& system : systems)
+    {
+      system->GetCoreTiming().Shutdown();
+      system->GetPowerPC().Shutdown();
+      system.reset();
+    }
+    Core::UndeclareAsCPUThread();
+  }
+
+  SConfig::Shutdown();
+  Config::Shutdown();
+  File::DeleteDirRecursively(profile_path);
+}
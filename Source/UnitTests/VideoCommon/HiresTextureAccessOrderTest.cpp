@@ -0,0 +1,100 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "VideoCommon/HiresTextureAccessOrder.h"
+
+namespace
+{
+constexpr size_t DISTANCE = HiresTextureAccessOrder::PREFETCH_DISTANCE;
+
+std::string TextureName(size_t index)
+{
+  return fmt::format("tex1_{}", index);
+}
+
+std::string MakeSavedOrder(size_t count)
+{
+  std::string order;
+  for (size_t i = 0; i < count; ++i)
+    order += TextureName(i) + '\n';
+  return order;
+}
+
+// The textures in [begin, end), in the order they are expected to be requested in.
+std::vector<std::string> ExpectedPrefetch(size_t begin, size_t end)
+{
+  std::vector<std::string> textures;
+  for (size_t i = end; i-- > begin;)
+    textures.push_back(TextureName(i));
+  return textures;
+}
+
+bool AllExist(const std::string&)
+{
+  return true;
+}
+}  // namespace
+
+TEST(HiresTextureAccessOrder, RecordsFirstUses)
+{
+  HiresTextureAccessOrder order;
+  EXPECT_EQ("", order.Save());
+
+  EXPECT_TRUE(order.RecordAccess("b").empty());
+  order.RecordAccess("a");
+  order.RecordAccess("b");
+  order.RecordAccess("c");
+  EXPECT_EQ("b\na\nc\n", order.Save());
+}
+
+TEST(HiresTextureAccessOrder, KeepsUnreachedTexturesOfPreviousRuns)
+{
+  HiresTextureAccessOrder order;
+  order.Load("a\nb\nremoved\nc\nb\nd\n", [](const std::string& id) { return id != "removed"; });
+  order.RecordAccess("c");
+  order.RecordAccess("e");
+  EXPECT_EQ("c\ne\na\nb\nd\n", order.Save());
+
+  // A run that doesn't use any texture leaves the saved order alone.
+  order.Clear();
+  EXPECT_EQ("", order.Save());
+}
+
+TEST(HiresTextureAccessOrder, PrefetchesWindowAhead)
+{
+  HiresTextureAccessOrder order;
+  order.Load(MakeSavedOrder(DISTANCE * 4), AllExist);
+  EXPECT_EQ(ExpectedPrefetch(0, DISTANCE), order.GetInitialPrefetch());
+
+  // The window only grows by the textures that haven't been prefetched yet.
+  EXPECT_TRUE(order.RecordAccess(TextureName(0)).empty());
+  EXPECT_EQ(ExpectedPrefetch(DISTANCE, DISTANCE + 9), order.RecordAccess(TextureName(9)));
+  // Using a texture again doesn't prefetch anything.
+  EXPECT_TRUE(order.RecordAccess(TextureName(9)).empty());
+  // Neither does going back.
+  EXPECT_TRUE(order.RecordAccess(TextureName(5)).empty());
+  // Textures that previous runs didn't use are only recorded.
+  EXPECT_TRUE(order.RecordAccess("new").empty());
+}
+
+TEST(HiresTextureAccessOrder, SkippingAheadDoesNotPrefetchSkippedTextures)
+{
+  HiresTextureAccessOrder order;
+  order.Load(MakeSavedOrder(DISTANCE * 4), AllExist);
+  order.GetInitialPrefetch();
+
+  const size_t index = DISTANCE * 2;
+  EXPECT_EQ(ExpectedPrefetch(index, index + DISTANCE), order.RecordAccess(TextureName(index)));
+  // The textures between the two windows stay skipped.
+  EXPECT_TRUE(order.RecordAccess(TextureName(DISTANCE + 1)).empty());
+
+  // The window stops at the end of the saved order.
+  const size_t last = DISTANCE * 4 - 1;
+  EXPECT_EQ(ExpectedPrefetch(last, last + 1), order.RecordAccess(TextureName(last)));
+}